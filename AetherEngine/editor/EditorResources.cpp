@@ -30,8 +30,8 @@ namespace aether {
         // Using your VFS signature: bool Resolve(const std::string&, std::filesystem::path&)
         if (VFS::Resolve(virtualPath, physicalPath))
         {
-            // physicalPath.string() gives the absolute path on the disk for stb_image to load
-            return std::make_shared<Texture2D>(physicalPath.string());
+            // Decoded off the main thread; the browser shows the placeholder until it lands
+            return Texture2D::LoadAsync(physicalPath.string());
         }
 
         AETHER_CORE_ERROR("EditorResources: Failed to resolve icon path: {}", virtualPath);
@@ -5,8 +5,15 @@
 #include "../../engine/project/Project.h"
 #include "../../engine/project/ProjectSerializer.h"
 #include "../../engine/asset/AssetManager.h"
+#include "../../engine/asset/TextureAtlasCooker.h"
+#include "../../engine/asset/TextureCooker.h"
 #include "../../engine/input/Input.h"       
 #include "../../engine/input/KeyCodes.h"    
+#include "../../engine/renderer/Renderer2D.h"
+#include "../../engine/renderer/TextureAtlas.h"
+#include "../../engine/renderer/GLStateCache.h"
+#include "../../engine/renderer/ShaderReloader.h"
+#include "../../engine/renderer/TextureLoader.h"
 #include "../EditorResources.h"
 #include "../panels/TextureViewerPanel.h"
 #include "../commands/CommandHistory.h"     
@@ -14,7 +21,6 @@
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <filesystem>
-#include <glad/glad.h>
 
 namespace aether {
 
@@ -55,6 +61,7 @@ namespace aether {
 
         EditorResources::Init();
         AssetManager::Init();
+        LoadTextureAtlases();
 
         m_ContentBrowserPanel.SetOnAssetOpenedCallback([this](const std::filesystem::path& path)
             {
@@ -70,6 +77,7 @@ namespace aether {
             ImGui::SaveIniSettingsToDisk(ImGui::GetIO().IniFilename);
         }
         SaveSettings();
+        TextureAtlas::ClearRegistered();
         AssetManager::Shutdown();
         EditorResources::Shutdown();
     }
@@ -93,22 +101,23 @@ namespace aether {
             m_ViewportSize.x > 0.0f && m_ViewportSize.y > 0.0f &&
             (spec.Width != (uint32_t)m_ViewportSize.x || spec.Height != (uint32_t)m_ViewportSize.y))
         {
+            // Reallocating the attachments is GL work; the render thread holds the context until now
+            Engine::Get().GetRenderThread()->ReclaimContext();
             m_Framebuffer->Resize((uint32_t)m_ViewportSize.x, (uint32_t)m_ViewportSize.y);
             m_EditorCamera.SetViewportSize(m_ViewportSize.x, m_ViewportSize.y);
         }
 
         if (m_ViewportFocused) m_EditorCamera.OnUpdate(ts);
 
-        m_Framebuffer->Bind();
+        RenderCommandBuffer& commands = Engine::Get().GetRenderThread()->GetWritePacket().Commands;
         Theme theme;
-        glClearColor(theme.WindowBg.x, theme.WindowBg.y, theme.WindowBg.z, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        commands.BindFramebuffer(m_Framebuffer.get(), { theme.WindowBg.x, theme.WindowBg.y, theme.WindowBg.z, 1.0f });
 
         World* world = Engine::Get().GetWorld();
         if (world) {
             world->OnUpdate(ts, m_EditorCamera.GetViewProjection());
         }
-        m_Framebuffer->Unbind();
+        commands.UnbindFramebuffer(m_Framebuffer.get());
     }
 
     void EditorLayer::OnEvent(Event& e)
@@ -218,6 +227,8 @@ namespace aether {
                     ProjectSerializer s(Project::GetActive());
                     s.Serialize(Project::GetActive()->GetProjectDirectory() / (Project::GetActiveConfig().Name + ".aether"));
                 }
+                if (ImGui::MenuItem("Cook Texture Atlas")) CookTextureAtlas();
+                if (ImGui::MenuItem("Cook Textures")) TextureCooker::CookProject();
                 if (ImGui::MenuItem("Exit")) Engine::Get().Close();
                 ImGui::PopStyleColor();
                 ImGui::EndMenu();
@@ -247,6 +258,7 @@ namespace aether {
             if (ImGui::BeginMenu("View")) {
                 ImGui::PushStyleColor(ImGuiCol_Text, theme.Text);
                 if (ImGui::MenuItem("Reset Layout")) EnsureLayout(dockspace_id);
+                ImGui::MenuItem("Renderer Stats", nullptr, &m_ShowRendererStats);
                 ImGui::PopStyleColor();
                 ImGui::EndMenu();
             }
@@ -264,6 +276,10 @@ namespace aether {
         m_ContentBrowserPanel.OnImGuiRender();
 
         RenderPreferencesPanel();
+        RenderStatsPanel();
+        // The render thread is idle here, so the counters just shown cover exactly one executed frame
+        Renderer2D::ResetStats();
+        GLStateCache::ResetStats();
 
         for (auto it = m_AssetEditors.begin(); it != m_AssetEditors.end(); ) {
             (*it)->OnImGuiRender();
@@ -315,6 +331,73 @@ namespace aether {
         ImGui::End();
     }
 
+    void EditorLayer::LoadTextureAtlases()
+    {
+        TextureAtlas::ClearRegistered();
+
+        for (const auto& [handle, metadata] : AssetManager::GetLibrary()) {
+            if (metadata.Type != AssetType::TextureAtlas) continue;
+
+            if (auto atlas = TextureAtlas::Load(Project::GetAssetDirectory() / metadata.FilePath))
+                TextureAtlas::Register(atlas);
+        }
+    }
+
+    void EditorLayer::CookTextureAtlas()
+    {
+        std::vector<UUID> textures;
+        for (const auto& [handle, metadata] : AssetManager::GetLibrary()) {
+            if (metadata.Type == AssetType::Texture2D) textures.push_back(handle);
+        }
+
+        if (textures.empty()) {
+            AETHER_CORE_WARN("Cook Texture Atlas: no Texture2D assets in the project");
+            return;
+        }
+
+        if (TextureAtlasCooker::Cook(textures, "TextureAtlas.aeth"))
+            LoadTextureAtlases();
+    }
+
+    void EditorLayer::RenderStatsPanel()
+    {
+        if (!m_ShowRendererStats) return;
+
+        ImGui::Begin("Renderer Stats", &m_ShowRendererStats);
+
+        const auto& stats = Renderer2D::GetStats();
+        ImGui::Text("Draw Calls: %u", stats.DrawCalls);
+        ImGui::Text("Quads: %u", stats.QuadCount);
+        ImGui::Text("Instanced: %u", stats.InstanceCount);
+        ImGui::Text("Vertices: %u", stats.GetVertexCount());
+        ImGui::Text("Indices: %u", stats.GetIndexCount());
+
+        ImGui::Separator();
+        ImGui::Text("Stream Stalls: %u (%.3f ms)", stats.StreamStalls, stats.StreamWaitMs);
+        ImGui::Text("Stream Overflows: %u", stats.StreamOverflows);
+
+        const auto& glStats = GLStateCache::GetStats();
+        ImGui::Text("GL State Calls: %u issued, %u elided", glStats.Issued, glStats.Elided);
+
+        if (ShaderReloader::IsEnabled()) {
+            const auto& reloadStats = ShaderReloader::GetStats();
+            ImGui::Text("Shader Reloads: %u (%u failed, %u compiling)", reloadStats.Reloads, reloadStats.Failures, reloadStats.Compiling);
+        }
+
+        const TextureStreamer::Statistics textureStats = TextureLoader::GetStats();
+        ImGui::Text("Textures Streamed: %u (%u pending, %u failed)", textureStats.Decoded, textureStats.Pending, textureStats.Failed);
+        ImGui::Text("Texture Decode: %.1f ms, %.1f MB uploaded", textureStats.DecodeMs, textureStats.UploadedBytes / (1024.0 * 1024.0));
+
+        if (World* world = Engine::Get().GetWorld()) {
+            const CullStats& cull = world->GetScene()->GetCullStats();
+            ImGui::Separator();
+            ImGui::Text("Sprites Submitted: %u", cull.Submitted);
+            ImGui::Text("Sprites Culled: %u / %u%s", cull.Culled, cull.Considered, cull.UsedSpatialIndex ? " (spatial index)" : "");
+        }
+
+        ImGui::End();
+    }
+
     void EditorLayer::EnsureLayout(unsigned int dockspace_id)
     {
         ImGui::DockBuilderRemoveNode(dockspace_id);
@@ -59,6 +59,10 @@ namespace aether {
         void EnsureLayout(unsigned int dockspace_id);
         void OpenAsset(const std::filesystem::path& path);
 
+        // --- Texture Atlases ---
+        void LoadTextureAtlases();
+        void CookTextureAtlas();
+
         // --- Event Handlers ---
         bool OnFileDrop(FileDropEvent& e);
         bool OnKeyPressed(KeyPressedEvent& e);
@@ -67,6 +71,7 @@ namespace aether {
         void LoadSettings();
         void SaveSettings();
         void RenderPreferencesPanel();
+        void RenderStatsPanel();
 
     private:
         bool m_IsFirstFrame = true;
@@ -76,6 +81,7 @@ namespace aether {
         // --- Editor State ---
         EditorSettings m_Settings;
         bool m_ShowPreferences = false;
+        bool m_ShowRendererStats = false;
 
         // --- Viewport State ---
         bool m_ViewportFocused = false;
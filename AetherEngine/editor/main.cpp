@@ -17,6 +17,15 @@ int main(int argc, char* argv[])
     aether::Log::Init();
 
     try {
+#ifdef AETHER_ENGINE_CONTENT_SOURCE_DIR
+        // Mounts resolve in order: with the source tree present (developer builds), engine
+        // shaders come from it, so the shader watcher sees edits to the real files instead
+        // of the post-build copy. Anything not found there falls through to the copy.
+        if (std::filesystem::exists(AETHER_ENGINE_CONTENT_SOURCE_DIR)) {
+            aether::VFS::Mount("/engine", AETHER_ENGINE_CONTENT_SOURCE_DIR);
+        }
+#endif
+
         if (std::filesystem::exists("EngineContent")) {
             aether::VFS::Mount("/engine", "EngineContent");
         }
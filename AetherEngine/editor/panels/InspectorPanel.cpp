@@ -1,5 +1,6 @@
 #include "InspectorPanel.h"
 #include "../../engine/ecs/Components.h"
+#include "../../engine/ecs/ComponentReflection.h"
 #include <imgui.h>
 #include <imgui_internal.h>
 #include <glm/gtc/type_ptr.hpp>
@@ -61,6 +62,84 @@ namespace aether {
         ImGui::PopID();
     }
 
+    // Single angle, stored in radians and edited in degrees (like FieldFlags_Angle fields)
+    static void DrawAngleControl(const std::string& label, float& radians, float columnWidth = 100.0f)
+    {
+        ImGui::PushID(label.c_str());
+
+        ImGui::Columns(2);
+        ImGui::SetColumnWidth(0, columnWidth);
+        ImGui::Text(label.c_str());
+        ImGui::NextColumn();
+
+        ImGui::PushItemWidth(ImGui::CalcItemWidth());
+        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2{ 0, 0 });
+
+        float lineHeight = ImGui::GetFontSize() + ImGui::GetStyle().FramePadding.y * 2.0f;
+        ImVec2 buttonSize = { lineHeight + 3.0f, lineHeight };
+
+        if (ImGui::Button("R", buttonSize)) radians = 0.0f;
+        ImGui::SameLine();
+        float degrees = glm::degrees(radians);
+        if (ImGui::DragFloat("##Angle", &degrees, 0.5f, 0.0f, 0.0f, "%.1f deg"))
+            radians = glm::radians(degrees);
+        ImGui::PopItemWidth();
+
+        ImGui::PopStyleVar();
+        ImGui::Columns(1);
+        ImGui::PopID();
+    }
+
+    // Generic inspector: one widget per reflected field, driven by the descriptor table.
+    template<ReflectedComponent T>
+    static void DrawReflectedFields(T& component)
+    {
+        const auto& fields = ComponentReflection<T>::Fields;
+        for (size_t i = 0; i < fields.size(); i++)
+        {
+            const FieldDescriptor& field = fields[i];
+            if (field.HasFlag(FieldFlags_HideInInspector)) continue;
+
+            std::string label(field.Name);
+            switch (field.Type)
+            {
+            case FieldType::Float:
+            {
+                float& value = GetField<float>(&component, field);
+                if (field.HasFlag(FieldFlags_Color) && i + 3 < fields.size())
+                {
+                    ImGui::ColorEdit4(label.c_str(), &value);
+                    i += 3; // The color widget consumed the next 3 channels
+                }
+                else if (field.HasFlag(FieldFlags_Angle))
+                {
+                    float degrees = glm::degrees(value);
+                    if (ImGui::DragFloat(label.c_str(), &degrees))
+                        value = glm::radians(degrees);
+                }
+                else
+                {
+                    ImGui::DragFloat(label.c_str(), &value, 0.1f);
+                }
+                break;
+            }
+            case FieldType::Bool:
+                ImGui::Checkbox(label.c_str(), &GetField<bool>(&component, field));
+                break;
+            case FieldType::Int32:
+            case FieldType::Enum:
+                ImGui::InputScalar(label.c_str(), ImGuiDataType_S32, &GetField<int32_t>(&component, field));
+                break;
+            case FieldType::UInt32:
+                ImGui::InputScalar(label.c_str(), ImGuiDataType_U32, &GetField<uint32_t>(&component, field));
+                break;
+            case FieldType::UInt64:
+                ImGui::InputScalar(label.c_str(), ImGuiDataType_U64, &GetField<uint64_t>(&component, field));
+                break;
+            }
+        }
+    }
+
     void InspectorPanel::DrawComponents(Entity entity)
     {
         if (entity.HasComponent<TagComponent>())
@@ -103,14 +182,15 @@ namespace aether {
         {
             if (ImGui::CollapsingHeader("Transform", ImGuiTreeNodeFlags_DefaultOpen))
             {
-                auto& tc = entity.GetComponent<TransformComponent>();
+                // Proxy into the SoA transform streams; writes go straight through
+                auto tc = entity.GetComponent<TransformComponent>();
                 glm::vec3 pos = { tc.X, tc.Y, 0.0f };
                 DrawVec3Control("Position", pos);
                 tc.X = pos.x; tc.Y = pos.y;
 
-                glm::vec3 rot = { 0.0f, 0.0f, tc.Rotation };
-                DrawVec3Control("Rotation", rot);
-                tc.Rotation = rot.z;
+                float rotation = tc.Rotation;
+                DrawAngleControl("Rotation", rotation);
+                tc.Rotation = rotation;
 
                 glm::vec3 scale = { tc.ScaleX, tc.ScaleY, 1.0f };
                 DrawVec3Control("Scale", scale, 1.0f);
@@ -124,7 +204,10 @@ namespace aether {
             {
                 auto& cameraComp = entity.GetComponent<CameraComponent>();
 
-                ImGui::Checkbox("Primary", &cameraComp.Primary);
+                // Primary is indexed: write it through Patch so lookups stay current
+                bool primary = cameraComp.Primary;
+                if (ImGui::Checkbox("Primary", &primary))
+                    entity.Patch<CameraComponent>([primary](CameraComponent& camera) { camera.Primary = primary; });
 
                 const char* projectionTypeStrings[] = { "Perspective", "Orthographic" };
                 const char* currentProjectionTypeString = projectionTypeStrings[(int)cameraComp.ProjectionType];
@@ -167,8 +250,7 @@ namespace aether {
         {
             if (ImGui::CollapsingHeader("Sprite Renderer", ImGuiTreeNodeFlags_DefaultOpen))
             {
-                auto& sprite = entity.GetComponent<SpriteComponent>();
-                ImGui::ColorEdit4("Color", &sprite.R);
+                DrawReflectedFields(entity.GetComponent<SpriteComponent>());
             }
         }
     }
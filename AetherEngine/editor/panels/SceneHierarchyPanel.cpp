@@ -49,19 +49,36 @@ namespace aether {
 
                 ImGui::EndPopup();
             }
+
+            if (m_EntityToClone)
+            {
+                m_SelectionContext = m_Context->CloneSubtree(m_EntityToClone);
+                m_EntityToClone = {};
+            }
+
+            if (m_EntityToDestroy)
+            {
+                m_Context->DestroySubtree(m_EntityToDestroy);
+                // The selection may have been anywhere inside the destroyed subtree
+                if (m_SelectionContext && !m_SelectionContext.HasComponent<TagComponent>())
+                    m_SelectionContext = {};
+                m_EntityToDestroy = {};
+            }
         }
         ImGui::End();
     }
 
     void SceneHierarchyPanel::DrawEntityNode(Entity entity)
     {
-        auto& tag = entity.GetComponent<TagComponent>().Tag;
+        // Resolve both pools once for this node
+        auto view = entity.GetView<TagComponent, RelationshipComponent>();
+        auto& tag = view.Get<TagComponent>().Tag;
 
         ImGuiTreeNodeFlags flags = ((m_SelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
         flags |= ImGuiTreeNodeFlags_SpanAvailWidth;
 
-        auto& rc = entity.GetComponent<RelationshipComponent>();
-        if (rc.FirstChild == NULL_ENTITY)
+        auto relationship = view.GetRef<RelationshipComponent>();
+        if (relationship->FirstChild == NULL_ENTITY)
         {
             flags |= ImGuiTreeNodeFlags_Leaf;
         }
@@ -74,33 +91,28 @@ namespace aether {
             m_SelectionContext = entity;
         }
 
-        bool entityDeleted = false;
         if (ImGui::BeginPopupContextItem())
         {
+            if (ImGui::MenuItem("Duplicate Entity"))
+                m_EntityToClone = entity;
+
             if (ImGui::MenuItem("Delete Entity"))
-                entityDeleted = true;
+                m_EntityToDestroy = entity;
 
             ImGui::EndPopup();
         }
 
         if (opened)
         {
-            EntityID childID = rc.FirstChild;
+            EntityID childID = relationship->FirstChild;
             while (childID != NULL_ENTITY)
             {
                 Entity child{ childID, entity.GetRegistry() };
                 DrawEntityNode(child);
-                childID = child.GetComponent<RelationshipComponent>().NextSibling;
+                childID = child.GetRef<RelationshipComponent>()->NextSibling;
             }
 
             ImGui::TreePop();
         }
-
-        if (entityDeleted)
-        {
-            m_Context->DestroyEntity(entity);
-            if (m_SelectionContext == entity)
-                m_SelectionContext = {};
-        }
     }
 }
\ No newline at end of file
@@ -23,5 +23,9 @@ namespace aether {
     private:
         Scene* m_Context = nullptr; // : Raw pointer
         Entity m_SelectionContext;
+
+        // Structural edits are applied after the tree is drawn, never mid-iteration
+        Entity m_EntityToDestroy;
+        Entity m_EntityToClone;
     };
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "../../engine/core/Theme.h"
 #include "../../engine/project/Project.h"
 #include "../../engine/asset/AssetMetadata.h"
+#include "../../engine/asset/TextureCooker.h"
 #include "../../engine/vendor/json.hpp"
 
 #include <imgui.h>
@@ -54,16 +55,33 @@ namespace aether {
         if (!sourceRel.empty())
         {
             // The Source path in JSON is relative to Asset Dir, so we resolve it too
-            std::filesystem::path sourceFullPath = Project::GetAssetDirectory() / sourceRel;
-
-            TextureSpecification spec;
-            spec.MinFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
-            spec.MagFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
-            spec.WrapS = GL_REPEAT;
-            spec.WrapT = GL_REPEAT;
+            m_SourcePath = Project::GetAssetDirectory() / sourceRel;
+            LoadTexture();
+        }
+    }
 
-            m_Texture = std::make_shared<Texture2D>(sourceFullPath.string(), spec);
+    void TextureViewerPanel::LoadTexture()
+    {
+        TextureSpecification spec;
+        spec.MinFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
+        spec.MagFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
+        spec.WrapS = GL_REPEAT;
+        spec.WrapT = GL_REPEAT;
+
+        // Prefer the cooked .aetex (mips, no decode) unless the source changed since
+        std::filesystem::path cookedPath = Project::GetAssetDirectory() / TextureCooker::GetCookedPath(m_AssetPath);
+        std::error_code error;
+        bool cookedIsCurrent = std::filesystem::exists(cookedPath, error)
+            && std::filesystem::last_write_time(cookedPath, error) >= std::filesystem::last_write_time(m_SourcePath, error);
+
+        if (cookedIsCurrent) {
+            // .aetex loads synchronously, so a bad file (old version, truncated cook) shows up here
+            m_Texture = Texture2D::LoadAsync(cookedPath.string(), spec);
+            if (!m_Texture->IsFailed()) return;
+            AETHER_CORE_WARN("TextureViewer: cooked texture {} is unreadable, using the source", cookedPath.string());
         }
+
+        m_Texture = Texture2D::LoadAsync(m_SourcePath.string(), spec);
     }
 
     EditorSaveResult TextureViewerPanel::Save()
@@ -102,15 +120,8 @@ namespace aether {
         out.close();
 
         // 4. Reload Texture to reflect changes
-        if (m_Texture) {
-            std::filesystem::path sourceFullPath = m_Texture->GetPath();
-
-            TextureSpecification spec;
-            spec.MinFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
-            spec.MagFilter = m_IsPixelArt ? GL_NEAREST : GL_LINEAR;
-
-            m_Texture = std::make_shared<Texture2D>(sourceFullPath.string(), spec);
-        }
+        if (m_Texture)
+            LoadTexture();
 
         SetDirty(false);
         return EditorSaveResult::Success;
@@ -122,7 +133,7 @@ namespace aether {
         // This works because we are inside the window's Begin()/End() scope from the base class
         ImGui::SetWindowSize(ImVec2(400, 420), ImGuiCond_FirstUseEver);
 
-        if (!m_Texture) {
+        if (!m_Texture || m_Texture->IsFailed()) {
             ImGui::TextColored(ImVec4(1, 0, 0, 1), "Error: Texture source not found or invalid.");
             std::filesystem::path fullPath = Project::GetAssetDirectory() / m_AssetPath;
             ImGui::TextWrapped("Attempted: %s", fullPath.string().c_str());
@@ -131,6 +142,12 @@ namespace aether {
 
         RenderToolbar();
         ImGui::Separator();
+
+        if (!m_Texture->IsLoaded()) {
+            ImGui::TextDisabled("Loading...");
+            return;
+        }
+
         RenderPreview();
     }
 
@@ -23,8 +23,13 @@ namespace aether {
         // Helper to load the .aeth metadata + source png
         void LoadAsset();
 
+        // Loads the cooked .aetex when it is newer than the source, otherwise (or if the
+        // cooked file turns out stale or corrupt) the source itself
+        void LoadTexture();
+
     private:
         std::shared_ptr<Texture2D> m_Texture;
+        std::filesystem::path m_SourcePath; // Absolute
 
         // Editor State
         float m_Zoom = 1.0f;
@@ -3,6 +3,7 @@
 #include "../core/Log.h"
 #include "../vendor/json.hpp" 
 #include <fstream>
+#include <sstream>
 #include <algorithm>
 
 using json = nlohmann::json;
@@ -116,6 +117,26 @@ namespace aether {
         s_CurrentLibrary->AddAsset(metadata);
     }
 
+    std::filesystem::path AssetManager::GetTextureSource(const std::filesystem::path& assetPath)
+    {
+        std::ifstream stream(Project::GetAssetDirectory() / assetPath, std::ios::binary);
+        if (!stream) return {};
+
+        stream.seekg(sizeof(AssetHeader));
+        std::stringstream buffer;
+        buffer << stream.rdbuf();
+
+        json meta = json::parse(buffer.str(), nullptr, false);
+        if (meta.is_discarded() || !meta.contains("Source")) return {};
+        return Project::GetAssetDirectory() / meta["Source"].get<std::string>();
+    }
+
+    void AssetManager::RegisterAsset(const AssetMetadata& metadata)
+    {
+        if (!s_CurrentLibrary->HasAsset(metadata.Handle))
+            s_CurrentLibrary->AddAsset(metadata);
+    }
+
     void AssetManager::CreateAsset(const std::string& filename, const std::filesystem::path& directory, AssetType type)
     {
         std::string finalFilename = filename;
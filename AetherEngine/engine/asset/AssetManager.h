@@ -32,6 +32,12 @@ namespace aether {
         // --- Factory ---
         static void CreateAsset(const std::string& filename, const std::filesystem::path& directory, AssetType type);
 
+        // Adds an asset produced by a cook step (already written to disk) to the library
+        static void RegisterAsset(const AssetMetadata& metadata);
+
+        // Absolute path of the image a Texture2D .aeth wraps (its "Source" entry); empty if unreadable
+        static std::filesystem::path GetTextureSource(const std::filesystem::path& assetPath);
+
         // Generic Import: Detects file type and runs specific import logic (e.g. generates .aeth wrapper)
         static void ImportSourceFile(const std::filesystem::path& sourcePath);
 
@@ -20,7 +20,10 @@ namespace aether {
         // --- Raw Importable Types ---
         Texture2D,       // .png, .jpg (Waiting to be packed)
         Audio,           // .wav, .ogg
-        Font             // .ttf, .otf
+        Font,            // .ttf, .otf
+
+        // --- Cooked Types (appended: values are stored in .aeth headers) ---
+        TextureAtlas     // Packed pages + region table (see TextureAtlasCooker)
     };
 
     // Every .aeth file begins with this header.
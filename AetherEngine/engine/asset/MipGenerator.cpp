@@ -0,0 +1,193 @@
+#include "MipGenerator.h"
+#include "../core/SIMD.h"
+#include "../renderer/CookedTexture.h"
+#include <cstring>
+#include <vector>
+
+namespace aether {
+
+    static inline void AverageQuad(const uint8_t* a, const uint8_t* b, const uint8_t* c, const uint8_t* d, uint8_t* out)
+    {
+        for (int channel = 0; channel < 4; channel++)
+            out[channel] = (uint8_t)((a[channel] + b[channel] + c[channel] + d[channel] + 2) >> 2);
+    }
+
+    // Source taps of one destination texel along one axis
+    struct Footprint
+    {
+        uint32_t Index[3];
+        float Weight[3];
+        uint32_t Count;
+    };
+
+    // Even sizes are the plain 2-tap box. An odd size n = 2m + 1 uses the exact box over
+    // [x * n / m, (x + 1) * n / m]: taps 2x, 2x + 1, 2x + 2 weighted (m - x, m, x + 1) / n,
+    // so every source texel contributes and the level stays centred. Size 1 maps to itself.
+    static std::vector<Footprint> BuildFootprints(uint32_t size)
+    {
+        const uint32_t dstSize = std::max(1u, size / 2);
+        std::vector<Footprint> footprints(dstSize);
+        for (uint32_t x = 0; x < dstSize; x++)
+        {
+            Footprint& f = footprints[x];
+            if (size == 1)
+                f = { { 0, 0, 0 }, { 1.0f, 0.0f, 0.0f }, 1 };
+            else if ((size & 1) == 0)
+                f = { { 2 * x, 2 * x + 1, 0 }, { 0.5f, 0.5f, 0.0f }, 2 };
+            else
+            {
+                const float n = (float)size, m = (float)dstSize;
+                f = { { 2 * x, 2 * x + 1, 2 * x + 2 }, { (m - x) / n, m / n, (x + 1) / n }, 3 };
+            }
+        }
+        return footprints;
+    }
+
+    // Scalar path for levels with an odd dimension (at most one per axis in a chain)
+    static void DownsampleWeighted(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst)
+    {
+        const std::vector<Footprint> columns = BuildFootprints(width);
+        const std::vector<Footprint> rows = BuildFootprints(height);
+        const size_t srcPitch = (size_t)width * 4;
+
+        uint8_t* out = dst;
+        for (const Footprint& row : rows)
+        {
+            for (const Footprint& column : columns)
+            {
+                float sum[4] = {};
+                for (uint32_t j = 0; j < row.Count; j++)
+                {
+                    const uint8_t* line = src + srcPitch * row.Index[j];
+                    for (uint32_t i = 0; i < column.Count; i++)
+                    {
+                        const uint8_t* pixel = line + (size_t)column.Index[i] * 4;
+                        const float weight = row.Weight[j] * column.Weight[i];
+                        for (int channel = 0; channel < 4; channel++)
+                            sum[channel] += pixel[channel] * weight;
+                    }
+                }
+                for (int channel = 0; channel < 4; channel++)
+                    out[channel] = (uint8_t)std::min(255.0f, sum[channel] + 0.5f);
+                out += 4;
+            }
+        }
+    }
+
+    void DownsampleBox(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst)
+    {
+        if ((width > 1 && (width & 1)) || (height > 1 && (height & 1)))
+        {
+            DownsampleWeighted(src, width, height, dst);
+            return;
+        }
+
+        const uint32_t dstWidth = std::max(1u, width / 2);
+        const uint32_t dstHeight = std::max(1u, height / 2);
+        const size_t srcPitch = (size_t)width * 4;
+
+        for (uint32_t y = 0; y < dstHeight; y++)
+        {
+            const uint8_t* row0 = src + srcPitch * std::min(2 * y, height - 1);
+            const uint8_t* row1 = src + srcPitch * std::min(2 * y + 1, height - 1);
+            uint8_t* out = dst + (size_t)dstWidth * 4 * y;
+
+            uint32_t x = 0;
+
+            // Wide paths need both columns of every pair: only when the source is at least 2 wide
+            if (width >= 2)
+            {
+#if defined(AETHER_SIMD_AVX2)
+                {
+                    const __m256i zero = _mm256_setzero_si256();
+                    const __m256i rounding = _mm256_set1_epi16(2);
+                    for (; x + 4 <= dstWidth; x += 4)
+                    {
+                        // 8 source pixels per row -> 4 outputs; 16-bit sums per 128-bit lane
+                        __m256i a = _mm256_loadu_si256((const __m256i*)(row0 + x * 8));
+                        __m256i b = _mm256_loadu_si256((const __m256i*)(row1 + x * 8));
+                        __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+                        __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+
+                        // Add each pixel's horizontal neighbour: lane = [p0+p1, p4+p5] / [p2+p3, p6+p7]
+                        lo = _mm256_add_epi16(lo, _mm256_srli_si256(lo, 8));
+                        hi = _mm256_add_epi16(hi, _mm256_srli_si256(hi, 8));
+
+                        __m256i sum = _mm256_unpacklo_epi64(lo, hi);
+                        sum = _mm256_srli_epi16(_mm256_add_epi16(sum, rounding), 2);
+
+                        // Bytes 0-7 of each lane hold two outputs; gather them into the low 128 bits
+                        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0x08);
+                        _mm_storeu_si128((__m128i*)(out + x * 4), _mm256_castsi256_si128(packed));
+                    }
+                }
+#endif
+#if defined(AETHER_SIMD_SSE2)
+                {
+                    const __m128i zero = _mm_setzero_si128();
+                    const __m128i rounding = _mm_set1_epi16(2);
+                    for (; x + 2 <= dstWidth; x += 2)
+                    {
+                        __m128i a = _mm_loadu_si128((const __m128i*)(row0 + x * 8));
+                        __m128i b = _mm_loadu_si128((const __m128i*)(row1 + x * 8));
+                        __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+                        __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+                        lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+                        hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+
+                        __m128i sum = _mm_unpacklo_epi64(lo, hi);
+                        sum = _mm_srli_epi16(_mm_add_epi16(sum, rounding), 2);
+                        _mm_storel_epi64((__m128i*)(out + x * 4), _mm_packus_epi16(sum, sum));
+                    }
+                }
+#endif
+            }
+
+            for (; x < dstWidth; x++)
+            {
+                const size_t left = (size_t)std::min(2 * x, width - 1) * 4;
+                const size_t right = (size_t)std::min(2 * x + 1, width - 1) * 4;
+                AverageQuad(row0 + left, row0 + right, row1 + left, row1 + right, out + x * 4);
+            }
+        }
+    }
+
+    void PremultiplyAlpha(uint8_t* pixels, size_t pixelCount)
+    {
+        for (size_t i = 0; i < pixelCount; i++)
+        {
+            uint8_t* pixel = pixels + i * 4;
+            const uint32_t alpha = pixel[3];
+            for (int channel = 0; channel < 3; channel++)
+            {
+                // Exact round(c * a / 255) without a divide
+                uint32_t t = pixel[channel] * alpha + 128;
+                pixel[channel] = (uint8_t)((t + (t >> 8)) >> 8);
+            }
+        }
+    }
+
+    std::vector<uint8_t> BuildMipChain(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipCount)
+    {
+        size_t total = 0;
+        for (uint32_t level = 0; level < mipCount; level++)
+            total += CookedTextureHeader::GetMipSize(width, height, level);
+
+        std::vector<uint8_t> chain(total);
+        std::memcpy(chain.data(), pixels, CookedTextureHeader::GetMipSize(width, height, 0));
+
+        // Each level filters the one before it
+        size_t offset = 0;
+        for (uint32_t level = 1; level < mipCount; level++)
+        {
+            const size_t previousSize = CookedTextureHeader::GetMipSize(width, height, level - 1);
+            DownsampleBox(chain.data() + offset,
+                CookedTextureHeader::GetMipDimension(width, level - 1), CookedTextureHeader::GetMipDimension(height, level - 1),
+                chain.data() + offset + previousSize);
+            offset += previousSize;
+        }
+        return chain;
+    }
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aether {
+
+    // --- Mip Generation (offline) ---
+    // RGBA8 kernels used by TextureCooker. Filtering is a 2x2 box with round-to-nearest,
+    // AVX2 (4 output pixels per step) when enabled, SSE2 (2) on x64, scalar otherwise.
+
+    // dst is max(1, width / 2) x max(1, height / 2). An odd dimension takes a weighted
+    // 3-tap box on that axis (scalar), so no source texel is dropped; a 1-pixel dimension
+    // is kept as is.
+    void DownsampleBox(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+    // rgb = rgb * a / 255, rounded. Filter after this step, or edges pick up the colour
+    // of fully transparent neighbours.
+    void PremultiplyAlpha(uint8_t* pixels, size_t pixelCount);
+
+    // mipCount levels, largest first, concatenated in .aetex order (see CookedTexture.h)
+    std::vector<uint8_t> BuildMipChain(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t mipCount);
+
+}
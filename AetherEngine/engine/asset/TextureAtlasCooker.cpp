@@ -0,0 +1,157 @@
+#include "TextureAtlasCooker.h"
+#include "AssetManager.h"
+#include "../core/Log.h"
+#include "MipGenerator.h"
+#include "../renderer/AtlasPacker.h"
+#include "../renderer/CookedTexture.h"
+#include "../vendor/json.hpp"
+#include "../vendor/stb_image.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+using json = nlohmann::json;
+
+namespace aether {
+
+    struct DecodedImage
+    {
+        uint64_t Texture = 0;
+        int Width = 0, Height = 0;
+        stbi_uc* Pixels = nullptr;
+    };
+
+    bool TextureAtlasCooker::Cook(const std::vector<UUID>& textures, const std::filesystem::path& outputPath, const Settings& settings)
+    {
+        // 1. Decode every source image (same orientation as Texture2D: bottom row first)
+        std::vector<DecodedImage> images;
+        std::vector<AtlasPackInput> inputs;
+        stbi_set_flip_vertically_on_load(1);
+
+        for (UUID texture : textures)
+        {
+            if (!AssetManager::HasAsset(texture)) continue;
+            const AssetMetadata& metadata = AssetManager::GetMetadata(texture);
+            if (metadata.Type != AssetType::Texture2D) continue;
+
+            std::filesystem::path source = AssetManager::GetTextureSource(metadata.FilePath);
+            DecodedImage image;
+            image.Texture = (uint64_t)texture;
+            int channels = 0;
+            image.Pixels = stbi_load(source.string().c_str(), &image.Width, &image.Height, &channels, 4);
+            if (!image.Pixels)
+            {
+                AETHER_CORE_WARN("TextureAtlasCooker: could not decode '{0}', skipping", source.string());
+                continue;
+            }
+
+            // Filter after premultiplying, or edges pick up transparent neighbours' colour
+            PremultiplyAlpha(image.Pixels, (size_t)image.Width * image.Height);
+            images.push_back(image);
+        }
+
+        if (images.empty())
+        {
+            AETHER_CORE_WARN("TextureAtlasCooker: no textures to cook for '{0}'", outputPath.string());
+            return false;
+        }
+
+        // 2. Pack. Level i of the page averages 2^i x 2^i base texels, so blocks are aligned to
+        //    the last level's footprint and every block pixel is owned by a single image.
+        uint32_t mipCount = std::clamp(settings.MipLevels, 1u, CookedTextureHeader::GetFullMipCount(settings.PageSize, settings.PageSize));
+        while (mipCount > 1 && settings.PageSize % (1u << (mipCount - 1)) != 0)
+            mipCount--;
+        const uint32_t blockAlign = 1u << (mipCount - 1);
+        const uint32_t padding = std::max(settings.Padding, blockAlign);
+        auto blockSize = [&](int size) { return ((uint32_t)size + padding * 2 + blockAlign - 1) / blockAlign * blockAlign; };
+
+        for (const DecodedImage& image : images)
+            inputs.push_back({ image.Texture, blockSize(image.Width) - padding * 2, blockSize(image.Height) - padding * 2 });
+
+        AtlasLayout layout = PackAtlas(inputs, settings.PageSize, settings.PageSize, padding);
+        for (uint64_t rejected : layout.Rejected)
+            AETHER_CORE_WARN("TextureAtlasCooker: texture {0} is larger than a {1}px page, skipping", rejected, settings.PageSize);
+
+        // 3. Compose the base level of each page: the image, then its edge texels repeated over the block
+        const size_t pageBytes = (size_t)layout.PageWidth * layout.PageHeight * 4;
+        std::vector<uint8_t> pages(pageBytes * layout.PageCount, 0);
+
+        json regions = json::array();
+        for (const AtlasPlacement& placement : layout.Placements)
+        {
+            auto it = std::find_if(images.begin(), images.end(), [&](const DecodedImage& image) { return image.Texture == placement.ID; });
+            const DecodedImage& image = *it;
+
+            uint8_t* page = pages.data() + pageBytes * placement.Page;
+            const uint32_t blockX = placement.Rect.X - padding, blockY = placement.Rect.Y - padding;
+            const uint32_t blockWidth = blockSize(image.Width), blockHeight = blockSize(image.Height);
+            for (uint32_t y = 0; y < blockHeight; y++)
+            {
+                int srcY = std::clamp((int)(blockY + y) - (int)placement.Rect.Y, 0, image.Height - 1);
+                const stbi_uc* srcRow = image.Pixels + (size_t)srcY * image.Width * 4;
+                uint8_t* dst = page + ((size_t)(blockY + y) * layout.PageWidth + blockX) * 4;
+                for (uint32_t x = 0; x < blockWidth; x++)
+                {
+                    int srcX = std::clamp((int)(blockX + x) - (int)placement.Rect.X, 0, image.Width - 1);
+                    std::memcpy(dst + x * 4, srcRow + (size_t)srcX * 4, 4);
+                }
+            }
+
+            regions.push_back({
+                { "Texture", placement.ID },
+                { "Page", placement.Page },
+                { "Rect", { placement.Rect.X, placement.Rect.Y, image.Width, image.Height } }
+            });
+        }
+
+        for (DecodedImage& image : images)
+            stbi_image_free(image.Pixels);
+
+        std::vector<std::vector<uint8_t>> chains(layout.PageCount);
+        for (uint32_t i = 0; i < layout.PageCount; i++)
+            chains[i] = BuildMipChain(pages.data() + pageBytes * i, layout.PageWidth, layout.PageHeight, mipCount);
+
+        // 4. Write the .aeth
+        std::filesystem::path fullPath = Project::GetAssetDirectory() / outputPath;
+        UUID handle = AssetManager::HasAsset(outputPath) ? AssetManager::GetMetadata(outputPath).Handle : UUID();
+
+        std::ofstream fout(fullPath, std::ios::binary);
+        if (!fout)
+        {
+            AETHER_CORE_ERROR("TextureAtlasCooker: cannot write '{0}'", fullPath.string());
+            return false;
+        }
+
+        AssetHeader header;
+        header.Type = AssetType::TextureAtlas;
+        header.AssetID = (uint64_t)handle;
+        fout.write(reinterpret_cast<const char*>(&header), sizeof(AssetHeader));
+
+        json meta;
+        meta["PageWidth"] = layout.PageWidth;
+        meta["PageHeight"] = layout.PageHeight;
+        meta["PageCount"] = layout.PageCount;
+        meta["MipCount"] = mipCount;
+        meta["Premultiplied"] = true;
+        meta["Regions"] = regions;
+
+        std::string dump = meta.dump();
+        uint32_t jsonSize = (uint32_t)dump.size();
+        fout.write(reinterpret_cast<const char*>(&jsonSize), sizeof(jsonSize));
+        fout.write(dump.data(), dump.size());
+        for (const std::vector<uint8_t>& chain : chains)
+            fout.write(reinterpret_cast<const char*>(chain.data()), (std::streamsize)chain.size());
+        fout.close();
+
+        if (!AssetManager::HasAsset(handle))
+        {
+            AssetMetadata metadata;
+            metadata.Handle = handle;
+            metadata.FilePath = outputPath;
+            metadata.Type = AssetType::TextureAtlas;
+            AssetManager::RegisterAsset(metadata);
+        }
+        AETHER_CORE_INFO("TextureAtlasCooker: cooked {0} textures into {1} page(s): {2}", layout.Placements.size(), layout.PageCount, outputPath.string());
+        return true;
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include "../core/UUID.h"
+
+namespace aether {
+
+    // --- Texture Atlas Cooker ---
+    // Offline step: decodes the given Texture2D assets, packs them into pages and
+    // writes one TextureAtlas .aeth. Nothing is packed or filtered at load time; the
+    // runtime (renderer/TextureAtlas) only uploads the cooked pages and their mips.
+    //
+    // Pixels are premultiplied. Each image sits in a block aligned to 2^(MipCount - 1)
+    // texels whose gutter repeats the image's edge texels, so every mip texel of a
+    // block is filtered from that image alone and minified sprites do not bleed.
+    //
+    // File layout after the AssetHeader:
+    //   uint32 jsonSize | JSON { PageWidth, PageHeight, PageCount, MipCount, Premultiplied,
+    //                            Regions[{ Texture, Page, Rect[x,y,w,h] }] }
+    //   | PageCount x MipCount levels of RGBA8 per page, largest first, bottom row first
+    //     (same level layout as a cooked .aetex, see CookedTexture.h)
+    class TextureAtlasCooker
+    {
+    public:
+        struct Settings
+        {
+            uint32_t PageSize = 2048;
+            uint32_t Padding = 2;     // Minimum gutter; raised to the mip block size
+            uint32_t MipLevels = 4;   // Levels per page, including the base
+        };
+
+        // outputPath is relative to the project's asset directory. Returns false if nothing could be cooked.
+        static bool Cook(const std::vector<UUID>& textures, const std::filesystem::path& outputPath, const Settings& settings);
+        static bool Cook(const std::vector<UUID>& textures, const std::filesystem::path& outputPath) { return Cook(textures, outputPath, Settings()); }
+    };
+}
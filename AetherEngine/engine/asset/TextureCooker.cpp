@@ -0,0 +1,92 @@
+#include "TextureCooker.h"
+#include "AssetManager.h"
+#include "MipGenerator.h"
+#include "../core/Log.h"
+#include "../renderer/CookedTexture.h"
+#include "../vendor/stb_image.h"
+#include <fstream>
+
+namespace aether {
+
+    bool TextureCooker::Cook(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath, const Settings& settings)
+    {
+        // 1. Decode (same orientation as Texture2D: bottom row first), always as RGBA8
+        stbi_set_flip_vertically_on_load(1);
+        int width = 0, height = 0, channels = 0;
+        stbi_uc* pixels = stbi_load(sourcePath.string().c_str(), &width, &height, &channels, 4);
+        if (!pixels)
+        {
+            AETHER_CORE_WARN("TextureCooker: could not decode '{0}'", sourcePath.string());
+            return false;
+        }
+
+        // 2. Premultiply before filtering, then build the chain
+        if (settings.PremultiplyAlpha)
+            PremultiplyAlpha(pixels, (size_t)width * height);
+
+        CookedTextureHeader header;
+        header.Width = (uint32_t)width;
+        header.Height = (uint32_t)height;
+        header.MipCount = settings.GenerateMips ? CookedTextureHeader::GetFullMipCount(header.Width, header.Height) : 1;
+        header.Flags = settings.PremultiplyAlpha ? (uint32_t)CookedTextureHeader::PremultipliedAlpha : 0u;
+
+        std::vector<uint8_t> chain = BuildMipChain(pixels, header.Width, header.Height, header.MipCount);
+        stbi_image_free(pixels);
+
+        // 3. Write the .aetex
+        std::ofstream fout(outputPath, std::ios::binary | std::ios::trunc);
+        if (!fout)
+        {
+            AETHER_CORE_ERROR("TextureCooker: cannot write '{0}'", outputPath.string());
+            return false;
+        }
+
+        fout.write(reinterpret_cast<const char*>(&header), sizeof(CookedTextureHeader));
+        fout.write(reinterpret_cast<const char*>(chain.data()), (std::streamsize)chain.size());
+        if (!fout)
+        {
+            AETHER_CORE_ERROR("TextureCooker: failed writing '{0}'", outputPath.string());
+            return false;
+        }
+
+        AETHER_CORE_TRACE("TextureCooker: {0} -> {1} ({2}x{3}, {4} mips{5})", sourcePath.filename().string(), outputPath.filename().string(),
+            width, height, header.MipCount, settings.PremultiplyAlpha ? ", premultiplied" : "");
+        return true;
+    }
+
+    std::filesystem::path TextureCooker::GetCookedPath(const std::filesystem::path& assetPath)
+    {
+        std::filesystem::path cooked = assetPath;
+        cooked.replace_extension(".aetex");
+        return cooked;
+    }
+
+    uint32_t TextureCooker::CookProject(const Settings& settings)
+    {
+        uint32_t cooked = 0, upToDate = 0;
+        for (const auto& [handle, metadata] : AssetManager::GetLibrary())
+        {
+            if (metadata.Type != AssetType::Texture2D) continue;
+
+            std::filesystem::path source = AssetManager::GetTextureSource(metadata.FilePath);
+            if (source.empty() || !std::filesystem::exists(source)) continue;
+
+            std::filesystem::path output = Project::GetAssetDirectory() / GetCookedPath(metadata.FilePath);
+
+            // Incremental: a cook newer than its source is current
+            std::error_code error;
+            if (std::filesystem::exists(output, error)
+                && std::filesystem::last_write_time(output, error) >= std::filesystem::last_write_time(source, error))
+            {
+                upToDate++;
+                continue;
+            }
+
+            if (Cook(source, output, settings))
+                cooked++;
+        }
+
+        AETHER_CORE_INFO("TextureCooker: cooked {0} texture(s), {1} already up to date", cooked, upToDate);
+        return cooked;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+
+namespace aether {
+
+    // --- Texture Cooker ---
+    // Offline step: decodes a source image once and writes a .aetex (renderer/CookedTexture.h)
+    // with its full mip chain, so Texture2D loads it with plain reads and no decoding.
+    class TextureCooker
+    {
+    public:
+        struct Settings
+        {
+            bool GenerateMips = true;
+            // Store rgb * a. Mips are filtered after this, so transparent texels no longer
+            // bleed their colour into the edges; the renderer blends such textures as-is.
+            bool PremultiplyAlpha = true;
+        };
+
+        // Absolute paths. Returns false if the source cannot be decoded or the output written.
+        static bool Cook(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath, const Settings& settings);
+        static bool Cook(const std::filesystem::path& sourcePath, const std::filesystem::path& outputPath) { return Cook(sourcePath, outputPath, Settings()); }
+
+        // The cooked file that sits beside a Texture2D .aeth (same name, .aetex)
+        static std::filesystem::path GetCookedPath(const std::filesystem::path& assetPath);
+
+        // Cooks every Texture2D asset in the project whose .aetex is missing or older than
+        // its source. Returns the number of textures written.
+        static uint32_t CookProject(const Settings& settings);
+        static uint32_t CookProject() { return CookProject(Settings()); }
+    };
+}
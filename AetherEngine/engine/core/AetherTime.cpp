@@ -8,6 +8,7 @@ namespace aether {
 	// Sets the lastTime to the current time.
 	static clock::time_point lastTime;
 	static double deltaTime = 0.0;
+	static const clock::time_point startTime = clock::now();
 
 	// Update the delta time based on the current time.
 	void AetherTime::Init() {
@@ -27,4 +28,9 @@ namespace aether {
 		return deltaTime;
 	}
 
+	// Reads the clock directly, independent of the frame's Update().
+	double AetherTime::Now() {
+		return std::chrono::duration<double>(clock::now() - startTime).count();
+	}
+
 }
\ No newline at end of file
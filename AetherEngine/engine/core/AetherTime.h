@@ -30,5 +30,8 @@ namespace aether {
 
 		// One source of truth for delta time in seconds.
 		static double DeltaTime();
+
+		// Monotonic seconds since startup. Use for budgets and profiling, not gameplay.
+		static double Now();
 	};
 }
\ No newline at end of file
@@ -1,11 +1,16 @@
 #include "Engine.h"
 #include "../renderer/Renderer2D.h"
+#include "../renderer/Shader.h"
+#include "../renderer/ShaderReloader.h"
+#include "../renderer/TextureLoader.h"
 #include "../scene/World.h"
 #include "Log.h"
 #include "AetherTime.h"
 #include "EngineVersion.h"
 #include "VFS.h"
 
+#include <SDL.h>
+
 namespace aether {
 
     Engine* Engine::s_Instance = nullptr;
@@ -27,11 +32,42 @@ namespace aether {
             props.VSync = windowSettings.VSync;
             m_Window = std::unique_ptr<Window>(Window::Create(props));
             m_Window->SetEventCallback(AETHER_BIND_EVENT_FN(Engine::OnEvent));
+
+            if (char* prefPath = SDL_GetPrefPath("Aether", m_Spec.Name.c_str()))
+            {
+                m_UserDataDirectory = prefPath;
+                SDL_free(prefPath);
+            }
+
+            // The engine's own shaders are built in Renderer2D::Init, before any project
+            // is open, so the binary cache has to live somewhere known up front. Entries
+            // are keyed by source and driver, so one cache serves every project.
+            if (!m_UserDataDirectory.empty())
+                Shader::SetBinaryCacheDirectory(m_UserDataDirectory / "ShaderCache");
             Renderer2D::Init();
+            TextureLoader::Init();
+
+            // Edit shaders while the editor runs; shipped clients keep the programs they start with
+            if (m_Spec.Type == ApplicationType::Editor)
+                ShaderReloader::Init();
+
+            // Frame N is drawn, its ImGui draw data submitted and the window swapped on the
+            // render thread while layers simulate frame N+1. Event handling and ImGui's
+            // platform windows stay on the main thread, which reclaims the context for them.
+            auto backend = std::make_unique<Renderer2DBackend>(*m_Window, [this]() {
+                if (m_ImGuiLayer) m_ImGuiLayer->RenderDrawData();
+                });
+            m_RenderThread = std::make_unique<RenderThread>(std::move(backend), RenderThreadMode::Threaded);
         }
     }
 
-    Engine::~Engine() { Renderer2D::Shutdown(); }
+    Engine::~Engine() {
+        // Drain in-flight frames before the renderer they draw with goes away
+        m_RenderThread.reset();
+        ShaderReloader::Shutdown();
+        TextureLoader::Shutdown();
+        Renderer2D::Shutdown();
+    }
 
     void Engine::Close() { m_Running = false; }
 
@@ -63,28 +99,39 @@ namespace aether {
     {
         while (m_Running)
         {
-            if (!m_LayerOperations.empty()) {
-                for (auto& op : m_LayerOperations) op();
-                m_LayerOperations.clear();
-            }
-
             AetherTime::Update();
             float timestep = (float)AetherTime::DeltaTime();
 
             // 1. Update Layers (Game Logic)
-            // Client/Editor layers are responsible for calling World::OnUpdate with their specific Camera
+            // Client/Editor layers are responsible for calling World::OnUpdate with their specific Camera.
+            // They record into the render thread's write packet while it executes the previous frame.
             for (Layer* layer : m_LayerStack)
                 layer->OnUpdate(timestep);
 
-            // 2. Render UI
+            // 2. Everything below needs the GL context on this thread
+            if (m_RenderThread) m_RenderThread->ReclaimContext();
+            if (m_Window) m_Window->PollEvents();
+
+            if (!m_LayerOperations.empty()) {
+                for (auto& op : m_LayerOperations) op();
+                m_LayerOperations.clear();
+            }
+
+            ShaderReloader::Update();
+            TextureLoader::Update();
+
+            // 3. Build UI
             if (m_ImGuiLayer) {
                 m_ImGuiLayer->Begin();
                 for (Layer* layer : m_LayerStack) layer->OnImGuiRender();
                 m_ImGuiLayer->End();
             }
 
-            // 3. Swap Buffers
-            if (m_Window) m_Window->OnUpdate();
+            // 4. Draw, UI overlay and swap on the render thread
+            if (m_RenderThread) {
+                m_RenderThread->GetWritePacket().Commands.Present();
+                m_RenderThread->Submit();
+            }
         }
     }
 
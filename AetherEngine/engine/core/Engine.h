@@ -5,10 +5,12 @@
 #include "Layers/LayerStack.h"
 #include "Layers/ImGuiLayer.h"
 #include "../scene/World.h"
+#include "../renderer/RenderThread.h"
 #include <vector>
 #include <functional>
 #include <string>
 #include <memory>
+#include <filesystem>
 
 namespace aether {
 
@@ -57,9 +59,16 @@ namespace aether {
 
         const EngineSpecification& GetSpec() const { return m_Spec; }
 
+        // Per-user writable directory for this application (e.g. %APPDATA%/Aether/<Name>).
+        // Known before any project is opened; empty if the platform has none.
+        const std::filesystem::path& GetUserDataDirectory() const { return m_UserDataDirectory; }
+
         void SetWorld(std::unique_ptr<World> newWorld);
         World* GetWorld() { return m_ActiveWorld.get(); }
 
+        // Consumes extracted frame packets; null on the server
+        RenderThread* GetRenderThread() { return m_RenderThread.get(); }
+
     private:
         bool OnWindowClose(WindowCloseEvent& e);
 
@@ -67,11 +76,13 @@ namespace aether {
         bool m_Running = true;
 
         EngineSpecification m_Spec;
+        std::filesystem::path m_UserDataDirectory;
         LayerStack m_LayerStack;
         static Engine* s_Instance;
         ImGuiLayer* m_ImGuiLayer;
 
         std::unique_ptr<World> m_ActiveWorld;
+        std::unique_ptr<RenderThread> m_RenderThread;
 
         // Command Queue for safe layer operations
         std::vector<std::function<void()>> m_LayerOperations;
@@ -0,0 +1,70 @@
+#include "FileWatcher.h"
+#include "Log.h"
+#include <vector>
+
+namespace aether {
+
+    static std::filesystem::file_time_type GetWriteTime(const std::filesystem::path& path)
+    {
+        std::error_code error;
+        auto time = std::filesystem::last_write_time(path, error);
+        return error ? std::filesystem::file_time_type::min() : time;
+    }
+
+    FileWatcher::FileWatcher(ChangeCallback callback, std::chrono::milliseconds interval)
+        : m_Callback(std::move(callback)), m_Interval(interval)
+    {
+        AETHER_ASSERT(m_Callback, "FileWatcher needs a callback");
+        m_Thread = std::thread(&FileWatcher::ThreadLoop, this);
+    }
+
+    FileWatcher::~FileWatcher()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_Wake.notify_one();
+        m_Thread.join();
+    }
+
+    void FileWatcher::Watch(const std::filesystem::path& path)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Files.try_emplace(path.string(), GetWriteTime(path));
+    }
+
+    void FileWatcher::Unwatch(const std::filesystem::path& path)
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Files.erase(path.string());
+    }
+
+    void FileWatcher::ThreadLoop()
+    {
+        std::vector<std::filesystem::path> changed;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (!m_Wake.wait_for(lock, m_Interval, [this] { return m_Quit; }))
+        {
+            for (auto& [path, lastWrite] : m_Files)
+            {
+                // A missing file is mid-save (or deleted): keep the old time and look again later
+                auto writeTime = GetWriteTime(path);
+                if (writeTime == std::filesystem::file_time_type::min() || writeTime == lastWrite)
+                    continue;
+
+                lastWrite = writeTime;
+                changed.emplace_back(path);
+            }
+
+            // The callback may take a while (it reads the file): never hold the lock across it
+            lock.unlock();
+            for (const auto& path : changed)
+                m_Callback(path);
+            changed.clear();
+            lock.lock();
+        }
+    }
+
+}
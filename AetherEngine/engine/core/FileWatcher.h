@@ -0,0 +1,50 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <chrono>
+
+namespace aether {
+
+    // --- File Watcher ---
+    // Polls the modification time of a set of files on a background thread and calls
+    // the callback (on that thread) when one changes. Polling is portable and cheap for
+    // the handful of files the engine watches; it also survives editors that save by
+    // writing a temporary file and renaming it over the original.
+    class FileWatcher
+    {
+    public:
+        using ChangeCallback = std::function<void(const std::filesystem::path&)>;
+
+        FileWatcher(ChangeCallback callback, std::chrono::milliseconds interval = std::chrono::milliseconds(250));
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        // Watching an already watched path is a no-op; the current state is the baseline
+        void Watch(const std::filesystem::path& path);
+        void Unwatch(const std::filesystem::path& path);
+
+    private:
+        void ThreadLoop();
+
+    private:
+        ChangeCallback m_Callback;
+        std::chrono::milliseconds m_Interval;
+
+        // Path -> last seen write time (min() while the file is missing)
+        std::unordered_map<std::string, std::filesystem::file_time_type> m_Files;
+
+        std::thread m_Thread;
+        std::mutex m_Mutex;
+        std::condition_variable m_Wake;
+        bool m_Quit = false;
+    };
+
+}
@@ -1,5 +1,6 @@
 #include "ImGuiLayer.h"
 #include "../Engine.h"
+#include "../../renderer/GLStateCache.h"
 #include <imgui.h>
 #include <backends/imgui_impl_sdl2.h>
 #include <backends/imgui_impl_opengl3.h>
@@ -94,18 +95,33 @@ namespace aether {
         Engine& app = Engine::Get();
         io.DisplaySize = ImVec2((float)app.GetWindow().GetWidth(), (float)app.GetWindow().GetHeight());
 
-        // Rendering
+        // Build draw data; submission happens in RenderDrawData on the render thread
         ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+        // Creating and destroying platform windows touches SDL, which stays on the main thread
         if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
         {
             SDL_Window* backup_current_window = SDL_GL_GetCurrentWindow();
             SDL_GLContext backup_current_context = SDL_GL_GetCurrentContext();
             ImGui::UpdatePlatformWindows();
+            SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
+        }
+    }
+
+    void ImGuiLayer::RenderDrawData()
+    {
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+        if (ImGui::GetIO().ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
+        {
+            SDL_Window* backup_current_window = SDL_GL_GetCurrentWindow();
+            SDL_GLContext backup_current_context = SDL_GL_GetCurrentContext();
             ImGui::RenderPlatformWindowsDefault();
             SDL_GL_MakeCurrent(backup_current_window, backup_current_context);
         }
+
+        // The ImGui backend sets GL state directly, bypassing the cache
+        GLStateCache::Invalidate();
     }
 
     void ImGuiLayer::OnEvent(Event& e)
@@ -20,6 +20,11 @@ namespace aether {
         void Begin();
         void End();
 
+        // Submits the draw data built by End(). Runs on the render thread inside the
+        // frame's Present; the data stays valid because the main thread reclaims the
+        // context (waiting for this) before the next Begin().
+        void RenderDrawData();
+
         void SetBlockEvents(bool block) { m_BlockEvents = block; }
 
     private:
@@ -0,0 +1,19 @@
+#pragma once
+
+// --- SIMD Capability Detection ---
+// AETHER_SIMD_AVX2: 8-wide float kernels. Requires building with AETHER_ENABLE_AVX2
+//                   (/arch:AVX2 or -mavx2), since not every target CPU has it.
+// AETHER_SIMD_SSE2: 4-wide float kernels. Part of the x86-64 baseline, always on for x64 builds.
+// Kernels must always provide a scalar fallback for other architectures.
+
+#if defined(__AVX2__)
+#define AETHER_SIMD_AVX2 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AETHER_SIMD_SSE2 1
+#endif
+
+#if defined(AETHER_SIMD_AVX2) || defined(AETHER_SIMD_SSE2)
+#include <immintrin.h>
+#endif
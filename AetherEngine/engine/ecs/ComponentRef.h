@@ -0,0 +1,82 @@
+#pragma once
+#include "Registry.h"
+#include <tuple>
+#include <type_traits>
+
+namespace aether {
+
+    // --- Cached Component Accessor ---
+    // Resolves the typed pool once. Every access after that is two indexed loads
+    // (sparse -> dense index -> data) with no type lookup or hashing.
+    // Stays valid while the Registry lives, even if the pool reallocates or the
+    // component moves inside it. Check IsValid() if the component may have been removed.
+    template<typename T>
+    class ComponentRef {
+    public:
+        ComponentRef() = default;
+        ComponentRef(EntityID entity, PoolFor<T>* pool)
+            : m_Entity(entity), m_Pool(pool) {
+        }
+
+        bool IsValid() const { return m_Pool && m_Pool->Has(m_Entity); }
+        explicit operator bool() const { return IsValid(); }
+
+        // T& for regular components, the reference proxy for custom storage
+        decltype(auto) Get() const {
+            static_assert(!IsTagComponent<T>, "Tag components have no data; use IsValid()");
+            AETHER_ASSERT(IsValid(), "ComponentRef: entity {0} no longer has component '{1}'!", (uint32_t)m_Entity, typeid(T).name());
+            return m_Pool->At(m_Pool->IndexOf(m_Entity));
+        }
+
+        decltype(auto) operator*() const { return Get(); }
+
+        auto operator->() const {
+            if constexpr (std::is_reference_v<decltype(Get())>)
+                return &Get();
+            else
+                return m_Pool->Get(m_Entity);
+        }
+
+        EntityID GetEntity() const { return m_Entity; }
+
+    private:
+        EntityID m_Entity = (EntityID)-1;
+        PoolFor<T>* m_Pool = nullptr;
+    };
+
+    // --- Cached Multi-Component Accessor ---
+    // Same as ComponentRef, for several components of one entity at once.
+    // Example: auto view = entity.GetView<TransformComponent, SpriteComponent>();
+    //          view.Get<SpriteComponent>().A = 0.5f;
+    template<typename... Ts>
+    class EntityView {
+    public:
+        EntityView() = default;
+        EntityView(EntityID entity, Registry& registry)
+            : m_Entity(entity), m_Pools{ registry.GetPool<Ts>()... } {
+        }
+
+        template<typename T>
+        bool Has() const { return std::get<PoolFor<T>*>(m_Pools)->Has(m_Entity); }
+
+        // True when the entity still owns every viewed component
+        bool IsValid() const { return (Has<Ts>() && ...); }
+
+        template<typename T>
+        decltype(auto) Get() const {
+            static_assert(!IsTagComponent<T>, "Tag components have no data; use Has<T>()");
+            auto* pool = std::get<PoolFor<T>*>(m_Pools);
+            AETHER_ASSERT(pool->Has(m_Entity), "EntityView: entity {0} does not have component '{1}'!", (uint32_t)m_Entity, typeid(T).name());
+            return pool->At(pool->IndexOf(m_Entity));
+        }
+
+        template<typename T>
+        ComponentRef<T> GetRef() const { return { m_Entity, std::get<PoolFor<T>*>(m_Pools) }; }
+
+        EntityID GetEntity() const { return m_Entity; }
+
+    private:
+        EntityID m_Entity = (EntityID)-1;
+        std::tuple<PoolFor<Ts>*...> m_Pools{};
+    };
+}
@@ -0,0 +1,340 @@
+#pragma once
+#include "Components.h"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace aether {
+
+    // --- Field Types ---
+    // The primitive storage types a reflected field can have.
+    // Enums are stored as their underlying 32-bit integer.
+    enum class FieldType : uint8_t
+    {
+        Float = 0,
+        Bool,
+        Int32,
+        UInt32,
+        UInt64,
+        Enum
+    };
+
+    constexpr uint32_t FieldTypeSize(FieldType type)
+    {
+        switch (type)
+        {
+        case FieldType::Float:  return 4;
+        case FieldType::Bool:   return 1;
+        case FieldType::Int32:  return 4;
+        case FieldType::UInt32: return 4;
+        case FieldType::UInt64: return 8;
+        case FieldType::Enum:   return 4;
+        }
+        return 0;
+    }
+
+    // Maps a C++ member type to its FieldType at compile time.
+    template<typename F>
+    constexpr FieldType DeduceFieldType()
+    {
+        if constexpr (std::is_enum_v<F>)
+        {
+            static_assert(sizeof(F) == 4, "Reflected enums must have a 32-bit underlying type");
+            return FieldType::Enum;
+        }
+        else if constexpr (std::is_same_v<F, bool>) return FieldType::Bool;
+        else if constexpr (std::is_same_v<F, float>) return FieldType::Float;
+        else if constexpr (std::is_integral_v<F> && std::is_signed_v<F> && sizeof(F) == 4) return FieldType::Int32;
+        else if constexpr (std::is_integral_v<F> && std::is_unsigned_v<F> && sizeof(F) == 4) return FieldType::UInt32;
+        else if constexpr (std::is_integral_v<F> && std::is_unsigned_v<F> && sizeof(F) == 8) return FieldType::UInt64;
+        else static_assert(sizeof(F) == 0, "Unsupported reflected field type");
+    }
+
+    // Number of valid values (0..Count-1) of an enum used by a reflected field.
+    // Decoders reject anything outside it instead of storing an invalid enum.
+    template<typename E>
+    struct ReflectedEnum;
+
+    template<> struct ReflectedEnum<ReplicationMode> { static constexpr uint32_t Count = 4; };
+    template<> struct ReflectedEnum<CameraComponent::Type> { static constexpr uint32_t Count = 2; };
+
+    template<typename F>
+    constexpr uint32_t DeduceEnumCount()
+    {
+        if constexpr (std::is_enum_v<F>) return ReflectedEnum<F>::Count;
+        else return 0;
+    }
+
+    // --- Field Flags ---
+    // Bitmask describing how serializers, the network layer and the editor treat a field.
+    enum FieldFlags : uint32_t
+    {
+        FieldFlags_None = 0,
+        FieldFlags_Serialize = 1 << 0,       // Written to scene files
+        FieldFlags_Replicate = 1 << 1,       // Included in network snapshots / deltas
+        FieldFlags_HideInInspector = 1 << 2, // Not drawn by the generic inspector
+        FieldFlags_Color = 1 << 3,           // First of 4 consecutive floats forming an RGBA color
+        FieldFlags_Angle = 1 << 4,           // Stored in radians, edited in degrees
+
+        FieldFlags_Default = FieldFlags_Serialize | FieldFlags_Replicate
+    };
+
+    // Describes a single member of a component: where it lives and what it is.
+    struct FieldDescriptor
+    {
+        std::string_view Name;  // Also used as the key in scene files
+        uint32_t Offset = 0;
+        uint32_t Size = 0;
+        FieldType Type = FieldType::Float;
+        uint32_t EnumCount = 0; // Enum fields only
+        uint32_t Flags = FieldFlags_Default;
+        ReplicationMode Replication = ReplicationMode::ServerToAll;
+
+        bool HasFlag(uint32_t flag) const { return (Flags & flag) != 0; }
+    };
+
+    // --- Component Reflection Table ---
+    // Specialize for every component that should be handled by the generic
+    // serializers, delta encoders and the inspector. Each specialization exposes:
+    //   static constexpr std::string_view Name;
+    //   static constexpr std::array<FieldDescriptor, N> Fields;
+    template<typename T>
+    struct ComponentReflection;
+
+    template<typename T>
+    concept ReflectedComponent = requires {
+        { ComponentReflection<T>::Name } -> std::convertible_to<std::string_view>;
+        ComponentReflection<T>::Fields;
+    };
+
+    // Builds a descriptor from a member. The FieldType is deduced from the member type
+    // and the serialized name defaults to the member name.
+#define AETHER_FIELD_NAMED(Type, Member, SerializedName, ...) \
+    ::aether::FieldDescriptor{ SerializedName, (uint32_t)offsetof(Type, Member), (uint32_t)sizeof(Type::Member), \
+        ::aether::DeduceFieldType<decltype(Type::Member)>(), ::aether::DeduceEnumCount<decltype(Type::Member)>(), __VA_ARGS__ }
+
+#define AETHER_FIELD(Type, Member, ...) AETHER_FIELD_NAMED(Type, Member, #Member, __VA_ARGS__)
+
+    template<>
+    struct ComponentReflection<TransformComponent>
+    {
+        static constexpr std::string_view Name = "Transform";
+        static constexpr std::array<FieldDescriptor, 6> Fields = { {
+            AETHER_FIELD(TransformComponent, X, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(TransformComponent, Y, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(TransformComponent, Rotation, FieldFlags_Default | FieldFlags_Angle, ReplicationMode::ServerToAll),
+            AETHER_FIELD(TransformComponent, ScaleX, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(TransformComponent, ScaleY, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(TransformComponent, Replication, FieldFlags_Serialize | FieldFlags_HideInInspector, ReplicationMode::InitialOnly)
+        } };
+    };
+
+    template<>
+    struct ComponentReflection<SpriteComponent>
+    {
+        static constexpr std::string_view Name = "Sprite";
+        static constexpr std::array<FieldDescriptor, 6> Fields = { {
+            AETHER_FIELD(SpriteComponent, R, FieldFlags_Default | FieldFlags_Color, ReplicationMode::ServerToAll),
+            AETHER_FIELD(SpriteComponent, G, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(SpriteComponent, B, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(SpriteComponent, A, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(SpriteComponent, Texture, FieldFlags_Default, ReplicationMode::ServerToAll),
+            AETHER_FIELD(SpriteComponent, Layer, FieldFlags_Default, ReplicationMode::ServerToAll)
+        } };
+    };
+
+    template<>
+    struct ComponentReflection<CameraComponent>
+    {
+        static constexpr std::string_view Name = "CameraComponent";
+        static constexpr std::array<FieldDescriptor, 9> Fields = { {
+            AETHER_FIELD(CameraComponent, ProjectionType, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, PerspectiveFOV, FieldFlags_Serialize | FieldFlags_Angle, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, PerspectiveNear, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, PerspectiveFar, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, OrthographicSize, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, OrthographicNear, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, OrthographicFar, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, Primary, FieldFlags_Serialize, ReplicationMode::None),
+            AETHER_FIELD(CameraComponent, FixedAspectRatio, FieldFlags_Serialize, ReplicationMode::None)
+        } };
+    };
+
+    template<>
+    struct ComponentReflection<RelationshipComponent>
+    {
+        static constexpr std::string_view Name = "Relationship";
+        static constexpr std::array<FieldDescriptor, 5> Fields = { {
+            AETHER_FIELD(RelationshipComponent, Parent, FieldFlags_Default | FieldFlags_HideInInspector, ReplicationMode::ServerToAll),
+            AETHER_FIELD(RelationshipComponent, FirstChild, FieldFlags_Default | FieldFlags_HideInInspector, ReplicationMode::ServerToAll),
+            AETHER_FIELD(RelationshipComponent, NextSibling, FieldFlags_Default | FieldFlags_HideInInspector, ReplicationMode::ServerToAll),
+            // Kept as "PrevSibling" so scenes saved before reflection still load
+            AETHER_FIELD_NAMED(RelationshipComponent, PreviousSibling, "PrevSibling", FieldFlags_Default | FieldFlags_HideInInspector, ReplicationMode::ServerToAll),
+            AETHER_FIELD(RelationshipComponent, ChildrenCount, FieldFlags_Default | FieldFlags_HideInInspector, ReplicationMode::ServerToAll)
+        } };
+    };
+
+    // --- Compile-Time Validation ---
+    // Catches descriptor tables that disagree with the actual member sizes.
+    template<ReflectedComponent T>
+    consteval bool ValidateReflection()
+    {
+        static_assert(std::is_standard_layout_v<T>, "Reflected components must be standard layout (offsetof)");
+        for (const auto& field : ComponentReflection<T>::Fields)
+        {
+            if (field.Size != FieldTypeSize(field.Type)) return false;
+            if (field.Offset + field.Size > sizeof(T)) return false;
+        }
+        return true;
+    }
+
+    static_assert(ValidateReflection<TransformComponent>(), "TransformComponent reflection table is invalid");
+    static_assert(ValidateReflection<SpriteComponent>(), "SpriteComponent reflection table is invalid");
+    static_assert(ValidateReflection<CameraComponent>(), "CameraComponent reflection table is invalid");
+    static_assert(ValidateReflection<RelationshipComponent>(), "RelationshipComponent reflection table is invalid");
+
+    // --- Generic Field Access ---
+
+    template<typename FieldT>
+    FieldT& GetField(void* component, const FieldDescriptor& field)
+    {
+        return *reinterpret_cast<FieldT*>(static_cast<uint8_t*>(component) + field.Offset);
+    }
+
+    template<typename FieldT>
+    const FieldT& GetField(const void* component, const FieldDescriptor& field)
+    {
+        return *reinterpret_cast<const FieldT*>(static_cast<const uint8_t*>(component) + field.Offset);
+    }
+
+    // False for bytes that are no valid value of the field's type: a bool other than
+    // 0/1 or an enum out of range. Storing either would be undefined behaviour.
+    inline bool IsValidFieldValue(const FieldDescriptor& field, const uint8_t* bytes)
+    {
+        if (field.Type == FieldType::Bool)
+            return bytes[0] <= 1;
+        if (field.Type == FieldType::Enum)
+        {
+            uint32_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+            return value < field.EnumCount;
+        }
+        return true;
+    }
+
+    // Calls func(field) for every field matching the flag mask.
+    template<ReflectedComponent T, typename Func>
+    void ForEachField(uint32_t flagMask, Func&& func)
+    {
+        for (const auto& field : ComponentReflection<T>::Fields)
+        {
+            if (field.Flags & flagMask)
+                func(field);
+        }
+    }
+
+    // --- Binary Serialization ---
+    // Tight memcpy loops over the descriptor table. No names are written;
+    // both sides share the same compiled table.
+
+    template<ReflectedComponent T>
+    void WriteBinary(const T& component, std::vector<uint8_t>& out, uint32_t flagMask = FieldFlags_Serialize)
+    {
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(&component);
+        for (const auto& field : ComponentReflection<T>::Fields)
+        {
+            if (!(field.Flags & flagMask)) continue;
+            out.insert(out.end(), base + field.Offset, base + field.Offset + field.Size);
+        }
+    }
+
+    // Returns false, leaving the component and cursor untouched, if the buffer is too
+    // short or holds an invalid value. Decodes into a copy committed only on success.
+    template<ReflectedComponent T>
+    bool ReadBinary(T& component, const uint8_t*& cursor, const uint8_t* end, uint32_t flagMask = FieldFlags_Serialize)
+    {
+        T decoded = component;
+        uint8_t* base = reinterpret_cast<uint8_t*>(&decoded);
+        const uint8_t* read = cursor;
+        for (const auto& field : ComponentReflection<T>::Fields)
+        {
+            if (!(field.Flags & flagMask)) continue;
+            if (read + field.Size > end || !IsValidFieldValue(field, read)) return false;
+            std::memcpy(base + field.Offset, read, field.Size);
+            read += field.Size;
+        }
+        component = decoded;
+        cursor = read;
+        return true;
+    }
+
+    // --- Delta Encoding ---
+    // Bit N of the mask is set when field N differs between the two snapshots.
+
+    template<ReflectedComponent T>
+    uint64_t ComputeDeltaMask(const T& previous, const T& current, uint32_t flagMask = FieldFlags_Replicate)
+    {
+        static_assert(ComponentReflection<T>::Fields.size() <= 64, "Delta masks support up to 64 fields");
+
+        const uint8_t* a = reinterpret_cast<const uint8_t*>(&previous);
+        const uint8_t* b = reinterpret_cast<const uint8_t*>(&current);
+        uint64_t mask = 0;
+        for (size_t i = 0; i < ComponentReflection<T>::Fields.size(); i++)
+        {
+            const auto& field = ComponentReflection<T>::Fields[i];
+            if (!(field.Flags & flagMask)) continue;
+            if (std::memcmp(a + field.Offset, b + field.Offset, field.Size) != 0)
+                mask |= (1ull << i);
+        }
+        return mask;
+    }
+
+    // Layout: [uint64 mask][changed field bytes in table order]
+    template<ReflectedComponent T>
+    void WriteDelta(const T& current, uint64_t mask, std::vector<uint8_t>& out)
+    {
+        const uint8_t* maskBytes = reinterpret_cast<const uint8_t*>(&mask);
+        out.insert(out.end(), maskBytes, maskBytes + sizeof(mask));
+
+        const uint8_t* base = reinterpret_cast<const uint8_t*>(&current);
+        for (size_t i = 0; i < ComponentReflection<T>::Fields.size(); i++)
+        {
+            if (!(mask & (1ull << i))) continue;
+            const auto& field = ComponentReflection<T>::Fields[i];
+            out.insert(out.end(), base + field.Offset, base + field.Offset + field.Size);
+        }
+    }
+
+    // All or nothing: a truncated delta, a mask naming fields the table lacks or an
+    // invalid value returns false with the component and cursor untouched.
+    template<ReflectedComponent T>
+    bool ApplyDelta(T& component, const uint8_t*& cursor, const uint8_t* end)
+    {
+        constexpr size_t fieldCount = ComponentReflection<T>::Fields.size();
+
+        uint64_t mask = 0;
+        if (cursor + sizeof(mask) > end) return false;
+        std::memcpy(&mask, cursor, sizeof(mask));
+        if (fieldCount < 64 && (mask >> fieldCount) != 0) return false;
+
+        T decoded = component;
+        const uint8_t* read = cursor + sizeof(mask);
+        uint8_t* base = reinterpret_cast<uint8_t*>(&decoded);
+        for (size_t i = 0; i < fieldCount; i++)
+        {
+            if (!(mask & (1ull << i))) continue;
+            const auto& field = ComponentReflection<T>::Fields[i];
+            if (read + field.Size > end || !IsValidFieldValue(field, read)) return false;
+            std::memcpy(base + field.Offset, read, field.Size);
+            read += field.Size;
+        }
+        component = decoded;
+        cursor = read;
+        return true;
+    }
+}
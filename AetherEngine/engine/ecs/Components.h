@@ -17,6 +17,15 @@ namespace aether {
         InitialOnly
     };
 
+    // --- Tag Components ---
+    // Empty marker types. The Registry detects them at compile time and stores
+    // membership only, so they cost no per-entity data and act as view filters.
+    struct StaticTag {};    // Never moves; eligible for static batching / spatial caching
+    struct DisabledTag {};  // Skipped by logic and rendering
+    struct SelectedTag {};  // Selected in the editor
+    struct NetDirtyTag {};  // Changed since the last network snapshot
+    struct DormantTag {};   // Far from every observer; dropped from hot queries until woken
+
     struct TagComponent {
         std::string Tag;
     };
@@ -43,6 +52,12 @@ namespace aether {
         float G = 1.0f;
         float B = 1.0f;
         float A = 1.0f;
+
+        // Texture2D asset UUID, resolved to an atlas region at render time (0 = untextured)
+        uint64_t Texture = 0;
+
+        // Sorting layer: lower layers draw first (clamped to [-128, 127])
+        int32_t Layer = 0;
     };
 
     struct CameraComponent {
@@ -61,4 +76,28 @@ namespace aether {
         bool Primary = true;
         bool FixedAspectRatio = false;
     };
-}
\ No newline at end of file
+
+    // Update frequency tier, assigned by SimulationLOD from the distance to the nearest observer
+    enum class SimulationTier : uint8_t {
+        Full = 0,   // Every tick
+        Half,       // Every 2nd tick
+        Quarter,    // Every 4th tick
+        Dormant     // Not simulated (carries DormantTag)
+    };
+
+    // Opt-in: only entities with this component are subject to simulation LOD
+    struct SimulationLODComponent {
+        SimulationTier Tier = SimulationTier::Full;
+        // Spreads reduced-rate entities across ticks instead of updating them all on the same one
+        uint8_t Phase = 0;
+
+        // Written by SimulationLOD: the last tick this entity was due, and the tick until
+        // which a Wake() keeps it at Full regardless of distance
+        uint64_t DueTick = ~0ull;
+        uint64_t AwakeUntilTick = 0;
+    };
+}
+
+// Custom storage for TransformComponent (SoA streams). Included here so every
+// translation unit that names TransformComponent sees the same pool type.
+#include "TransformStorage.h"
\ No newline at end of file
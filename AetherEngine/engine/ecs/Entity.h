@@ -1,5 +1,6 @@
 #pragma once
 #include "Registry.h"
+#include "ComponentRef.h"
 #include "../core/Log.h" 
 
 namespace aether {
@@ -12,35 +13,36 @@ namespace aether {
         }
 
         // --- ADD COMPONENT ---
+        // Returns T& (or the component's reference proxy for custom storage, e.g. TransformRef)
 
         template<typename T>
-        T& AddComponent() {
+        decltype(auto) AddComponent() {
             AETHER_ASSERT(m_Registry, "Cannot add component to null entity!");
             T component{};
             m_Registry->AddComponent<T>(m_EntityID, component);
 
-            T* ptr = m_Registry->GetComponent<T>(m_EntityID);
+            auto ptr = m_Registry->GetComponent<T>(m_EntityID);
             AETHER_ASSERT(ptr, "Failed to add component!");
             return *ptr;
         }
 
         template<typename T>
-        T& AddComponent(const T& component) {
+        decltype(auto) AddComponent(const T& component) {
             AETHER_ASSERT(m_Registry, "Cannot add component to null entity!");
             m_Registry->AddComponent<T>(m_EntityID, component);
 
-            T* ptr = m_Registry->GetComponent<T>(m_EntityID);
+            auto ptr = m_Registry->GetComponent<T>(m_EntityID);
             AETHER_ASSERT(ptr, "Failed to add component!");
             return *ptr;
         }
 
         template<typename T, typename... Args>
-        T& AddComponent(Args&&... args) {
+        decltype(auto) AddComponent(Args&&... args) {
             AETHER_ASSERT(m_Registry, "Cannot add component to null entity!");
             T component{ std::forward<Args>(args)... };
             m_Registry->AddComponent<T>(m_EntityID, component);
 
-            T* ptr = m_Registry->GetComponent<T>(m_EntityID);
+            auto ptr = m_Registry->GetComponent<T>(m_EntityID);
             AETHER_ASSERT(ptr, "Failed to add component!");
             return *ptr;
         }
@@ -53,15 +55,37 @@ namespace aether {
             m_Registry->RemoveComponent<T>(m_EntityID);
         }
 
+        // --- PATCH COMPONENT ---
+        // Writes through the registry so secondary indexes see the change
+        template<typename T, typename Func>
+        void Patch(Func&& func) {
+            AETHER_ASSERT(m_Registry, "Cannot patch component of null entity!");
+            m_Registry->Patch<T>(m_EntityID, std::forward<Func>(func));
+        }
+
         // --- GET COMPONENT ---
         template<typename T>
-        T& GetComponent() {
+        decltype(auto) GetComponent() {
             AETHER_ASSERT(m_Registry, "Cannot get component from null entity!");
-            T* component = m_Registry->GetComponent<T>(m_EntityID);
+            auto component = m_Registry->GetComponent<T>(m_EntityID);
             AETHER_ASSERT(component, "Entity {0} does not have component '{1}'!", (uint32_t)m_EntityID, typeid(T).name());
             return *component;
         }
 
+        // --- CACHED ACCESS ---
+        // Resolve the pool(s) once; use these when touching the same component repeatedly.
+        template<typename T>
+        ComponentRef<T> GetRef() const {
+            AETHER_ASSERT(m_Registry, "Cannot get component from null entity!");
+            return { m_EntityID, m_Registry->GetPool<T>() };
+        }
+
+        template<typename... Ts>
+        EntityView<Ts...> GetView() const {
+            AETHER_ASSERT(m_Registry, "Cannot get components from null entity!");
+            return { m_EntityID, *m_Registry };
+        }
+
         // --- UTILS ---
         template<typename T>
         bool HasComponent() {
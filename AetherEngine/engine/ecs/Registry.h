@@ -2,97 +2,443 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
-#include <typeindex>
+#include <atomic>
 #include <algorithm>
+#include <tuple>
+#include <type_traits>
+#include <cstdint>
+#include <typeinfo>
 #include "../core/Log.h"
 
 namespace aether {
 
     using EntityID = uint32_t;
 
+    // Empty structs are "tag" components: they carry no data, only membership.
+    template<typename T>
+    inline constexpr bool IsTagComponent = std::is_empty_v<T>;
+
+    // --- Component Type IDs ---
+    // Small dense integer per component type, assigned on first use. Indexes the
+    // Registry's pool table directly instead of hashing a std::type_index.
+    class ComponentTypeIDs {
+    public:
+        template<typename T>
+        static uint32_t Get() {
+            static const uint32_t id = s_Next.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+    private:
+        inline static std::atomic<uint32_t> s_Next{ 0 };
+    };
+
+    struct IPool;
+
+    // Receives membership and value changes from the pools it is attached to.
+    // OnInserted fires once the component's data is in place. OnErased fires once the
+    // entity has left the pool (the pool may still be compacting, so don't read its data).
+    // OnPatched fires when an existing component was written through Registry::Patch
+    // (or overwritten by AddComponent).
+    struct IPoolObserver {
+        virtual ~IPoolObserver() = default;
+        virtual void OnInserted(EntityID entity) = 0;
+        virtual void OnErased(EntityID entity) = 0;
+        virtual void OnPatched(EntityID entity) {}
+    };
+
+    // --- Persistent Cached Query ---
+    // Dense list of the entities that own every Include component and none of the
+    // Excluded ones. Membership is updated incrementally whenever one of the watched
+    // pools gains or loses an entity, so reading it is a walk over a prebuilt array.
+    // Created by Registry::RegisterQuery and owned by the Registry.
+    class CachedQuery : public IPoolObserver {
+    public:
+        const std::vector<EntityID>& GetEntities() const { return m_Dense; }
+        size_t Size() const { return m_Dense.size(); }
+        bool IsEmpty() const { return m_Dense.empty(); }
+
+        bool Contains(EntityID entity) const {
+            return entity < m_Sparse.size() && m_Sparse[entity] != UINT32_MAX;
+        }
+
+        // First match, or UINT32_MAX (handy for singletons such as the primary camera)
+        EntityID First() const { return m_Dense.empty() ? UINT32_MAX : m_Dense.front(); }
+
+        void OnInserted(EntityID entity) override { Refresh(entity); }
+        void OnErased(EntityID entity) override { Refresh(entity); }
+
+    private:
+        friend class Registry;
+
+        inline bool Matches(EntityID entity) const;
+
+        // Re-evaluates one entity after a watched pool changed
+        void Refresh(EntityID entity) {
+            bool matches = Matches(entity);
+            bool contained = Contains(entity);
+            if (matches && !contained) Insert(entity);
+            else if (!matches && contained) Erase(entity);
+        }
+
+        void Insert(EntityID entity) {
+            if (entity >= m_Sparse.size())
+                m_Sparse.resize((size_t)entity + 1, UINT32_MAX);
+            m_Sparse[entity] = (uint32_t)m_Dense.size();
+            m_Dense.push_back(entity);
+        }
+
+        void Erase(EntityID entity) {
+            uint32_t index = m_Sparse[entity];
+            EntityID last = m_Dense.back();
+            m_Dense[index] = last;
+            m_Sparse[last] = index;
+            m_Dense.pop_back();
+            m_Sparse[entity] = UINT32_MAX;
+        }
+
+        std::vector<const IPool*> m_Include;
+        std::vector<const IPool*> m_Exclude;
+        std::vector<uint32_t> m_IncludeIDs;
+        std::vector<uint32_t> m_ExcludeIDs;
+
+        std::vector<EntityID> m_Dense;
+        std::vector<uint32_t> m_Sparse;
+    };
+
+    // Marker for the exclusion list of a multi-component view
+    // Usage: registry.Each<SpriteComponent>(func, Exclude<DisabledTag>{});
+    template<typename... Ts>
+    struct Exclude {};
+
     // Interface ensures we can store different Component Pools in one list
-	// and call Remove/Has without knowing the type T
+	// and call Remove/Has without knowing the type T.
+    // Membership is a sparse set: a dense array of owners (fast iteration) and a
+    // sparse array indexed by EntityID holding the dense index (O(1) lookup, no hashing).
     struct IPool {
+        static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
         virtual ~IPool() = default;
         virtual void Remove(EntityID entity) = 0;
-        virtual bool Has(EntityID entity) = 0;
+
+        // Batch operations: one virtual call per pool instead of one per entity
+        virtual void RemoveBatch(const EntityID* entities, size_t count) = 0;
+
+        // Copies the component of src[i] (if any) onto dst[i]
+        virtual void CloneBatch(const EntityID* src, const EntityID* dst, size_t count) = 0;
+
+        bool Has(EntityID entity) const {
+            return entity < m_Sparse.size() && m_Sparse[entity] != InvalidIndex;
+        }
+
+        // Dense index of the entity, or InvalidIndex
+        uint32_t IndexOf(EntityID entity) const {
+            return entity < m_Sparse.size() ? m_Sparse[entity] : InvalidIndex;
+        }
+
+        size_t Size() const { return m_Dense.size(); }
+
+        // Owner of every dense slot, in storage order
+        const std::vector<EntityID>& GetEntities() const { return m_Dense; }
+
+        // Queries and indexes that watch this pool
+        void AddObserver(IPoolObserver* observer) { m_Observers.push_back(observer); }
+
+        void NotifyPatched(EntityID entity) {
+            for (IPoolObserver* observer : m_Observers)
+                observer->OnPatched(entity);
+        }
+
+    protected:
+        // Appends the entity to the dense array and returns its new index.
+        // Derived pools call NotifyInserted() once the data slot is filled.
+        uint32_t InsertIndex(EntityID entity) {
+            if (entity >= m_Sparse.size())
+                m_Sparse.resize((size_t)entity + 1, InvalidIndex);
+
+            uint32_t index = (uint32_t)m_Dense.size();
+            m_Dense.push_back(entity);
+            m_Sparse[entity] = index;
+            return index;
+        }
+
+        void NotifyInserted(EntityID entity) {
+            for (IPoolObserver* observer : m_Observers)
+                observer->OnInserted(entity);
+        }
+
+        // "Fast Removal": moves the last owner into the freed slot.
+        // Returns the freed index so derived pools can mirror the swap in their data.
+        uint32_t EraseIndex(EntityID entity) {
+            uint32_t removedIndex = m_Sparse[entity];
+            uint32_t lastIndex = (uint32_t)m_Dense.size() - 1;
+
+            if (removedIndex != lastIndex) {
+                EntityID lastEntity = m_Dense[lastIndex];
+                m_Dense[removedIndex] = lastEntity;
+                m_Sparse[lastEntity] = removedIndex;
+            }
+
+            m_Dense.pop_back();
+            m_Sparse[entity] = InvalidIndex;
+
+            for (IPoolObserver* observer : m_Observers)
+                observer->OnErased(entity);
+            return removedIndex;
+        }
+
+        std::vector<EntityID> m_Dense;
+        std::vector<uint32_t> m_Sparse;
+        std::vector<IPoolObserver*> m_Observers;
     };
 
+    inline bool CachedQuery::Matches(EntityID entity) const {
+        for (const IPool* pool : m_Include)
+            if (!pool->Has(entity)) return false;
+        for (const IPool* pool : m_Exclude)
+            if (pool->Has(entity)) return false;
+        return true;
+    }
+
     // A Pool stores ONE type of component for ALL entities (Contiguous Memory = Fast)
 	// Uses "Fast Removal" technique to avoid holes in the array
     template<typename T>
     class ComponentPool : public IPool {
     public:
+        // Data[i] belongs to GetEntities()[i]
         std::vector<T> Data;
 
-        // Maps to keep track of which Entity owns which index in the vector
-        std::unordered_map<EntityID, size_t> EntityToIndex;
-        std::unordered_map<size_t, EntityID> IndexToEntity;
-
         void Add(EntityID entity, T component) {
-            if (EntityToIndex.find(entity) != EntityToIndex.end()) {
+            if (Has(entity)) {
                 // Entity already has this component, just update it
-                Data[EntityToIndex[entity]] = component;
+                Data[m_Sparse[entity]] = component;
+                NotifyPatched(entity);
                 return;
             }
 
+            InsertIndex(entity);
             Data.push_back(component);
-            size_t index = Data.size() - 1;
-            EntityToIndex[entity] = index;
-            IndexToEntity[index] = entity;
+            NotifyInserted(entity);
         }
 
         void Remove(EntityID entity) override {
-            if (EntityToIndex.find(entity) == EntityToIndex.end()) return;
+            if (!Has(entity)) return;
 
-            // Fast Removal: Swap the removed element with the last element, then pop back.
-            // This avoids "holes" in the array.
-            size_t removedIndex = EntityToIndex[entity];
+            size_t removedIndex = EraseIndex(entity);
             size_t lastIndex = Data.size() - 1;
 
-            if (removedIndex != lastIndex) {
-                T lastElement = Data[lastIndex];
-                EntityID lastEntity = IndexToEntity[lastIndex];
+            if (removedIndex != lastIndex)
+                Data[removedIndex] = std::move(Data[lastIndex]);
+
+            Data.pop_back();
+        }
 
-                Data[removedIndex] = lastElement;
-                EntityToIndex[lastEntity] = removedIndex;
-                IndexToEntity[removedIndex] = lastEntity;
+        void RemoveBatch(const EntityID* entities, size_t count) override {
+            if (Data.empty()) return;
+            for (size_t i = 0; i < count; i++)
+                ComponentPool::Remove(entities[i]);
+        }
+
+        void CloneBatch(const EntityID* src, const EntityID* dst, size_t count) override {
+            for (size_t i = 0; i < count; i++) {
+                uint32_t index = IndexOf(src[i]);
+                if (index == InvalidIndex) continue;
+                T copy = Data[index]; // Add() may reallocate Data
+                Add(dst[i], copy);
             }
+        }
 
-            Data.pop_back();
-            EntityToIndex.erase(entity);
-            IndexToEntity.erase(lastIndex);
+        T* Get(EntityID entity) {
+            uint32_t index = IndexOf(entity);
+            if (index == InvalidIndex) return nullptr;
+            return &Data[index];
+        }
+
+        // Access by dense index (used by views)
+        T& At(size_t index) { return Data[index]; }
+    };
+
+    // Storage for empty "tag" components: membership only, no Data array.
+    // Marking 100k entities allocates 100k IDs, not 100k objects.
+    template<typename T>
+    class TagPool : public IPool {
+    public:
+        static_assert(IsTagComponent<T>, "TagPool is only for empty component types");
+
+        // Shared instance handed out by Get() so generic code (Entity::AddComponent) keeps working
+        inline static T Instance{};
+
+        void Add(EntityID entity) {
+            if (Has(entity)) return;
+            InsertIndex(entity);
+            NotifyInserted(entity);
+        }
+
+        void Remove(EntityID entity) override {
+            if (Has(entity)) EraseIndex(entity);
+        }
+
+        void RemoveBatch(const EntityID* entities, size_t count) override {
+            if (m_Dense.empty()) return;
+            for (size_t i = 0; i < count; i++)
+                TagPool::Remove(entities[i]);
+        }
+
+        void CloneBatch(const EntityID* src, const EntityID* dst, size_t count) override {
+            for (size_t i = 0; i < count; i++)
+                if (Has(src[i])) Add(dst[i]);
         }
 
         T* Get(EntityID entity) {
-            auto it = EntityToIndex.find(entity);
-            if (it == EntityToIndex.end()) return nullptr;
-            return &Data[it->second];
+            return Has(entity) ? &Instance : nullptr;
+        }
+    };
+
+    // Selects the storage for a component type at compile time.
+    // Specialize to give a component a custom layout (see TransformStorage.h for the SoA transform pool).
+    // A custom pool must derive from IPool and provide Add/Remove/Get/At and a Data member.
+    template<typename T>
+    struct StorageTraits {
+        using Pool = std::conditional_t<IsTagComponent<T>, TagPool<T>, ComponentPool<T>>;
+    };
+
+    template<typename T>
+    using PoolFor = typename StorageTraits<T>::Pool;
+
+    // Splits a pointer-to-member into its component and field types
+    template<auto Member>
+    struct FieldTraits;
+
+    template<typename T, typename F, F T::* Member>
+    struct FieldTraits<Member> {
+        using Component = T;
+        using Field = F;
+    };
+
+    // --- Secondary Index ---
+    // Maps a field value to the entities whose component holds it, e.g.
+    // CameraComponent::Primary -> { cameras with Primary == true }.
+    // Kept current from pool events; value changes are seen only when written
+    // through Registry::Patch (or AddComponent on an existing component).
+    template<auto Member>
+    class FieldIndex : public IPoolObserver {
+    public:
+        using Component = typename FieldTraits<Member>::Component;
+        using Key = typename FieldTraits<Member>::Field;
+
+        explicit FieldIndex(PoolFor<Component>* pool)
+            : m_Pool(pool) {
+            for (EntityID entity : pool->GetEntities())
+                Insert(entity, Read(entity));
+        }
+
+        // Entities whose field equals key (empty if none)
+        const std::vector<EntityID>& Find(const Key& key) const {
+            static const std::vector<EntityID> s_Empty;
+            auto it = m_Buckets.find(key);
+            return it != m_Buckets.end() ? it->second : s_Empty;
+        }
+
+        void OnInserted(EntityID entity) override { Insert(entity, Read(entity)); }
+
+        void OnErased(EntityID entity) override {
+            if (IsIndexed(entity)) Erase(entity);
         }
 
-        bool Has(EntityID entity) override {
-            return EntityToIndex.find(entity) != EntityToIndex.end();
+        void OnPatched(EntityID entity) override {
+            Key key = Read(entity);
+            if (IsIndexed(entity)) {
+                if (m_Keys[entity] == key) return;
+                Erase(entity);
+            }
+            Insert(entity, key);
+        }
+
+    private:
+        Key Read(EntityID entity) const {
+            decltype(auto) component = m_Pool->At(m_Pool->IndexOf(entity));
+            if constexpr (std::is_reference_v<decltype(component)>)
+                return component.*Member;
+            else
+                return static_cast<Component>(component).*Member; // Reference proxy (custom storage)
+        }
+
+        bool IsIndexed(EntityID entity) const {
+            return entity < m_Slots.size() && m_Slots[entity] != UINT32_MAX;
+        }
+
+        void Insert(EntityID entity, const Key& key) {
+            if (entity >= m_Slots.size()) {
+                m_Slots.resize((size_t)entity + 1, UINT32_MAX);
+                m_Keys.resize((size_t)entity + 1);
+            }
+            std::vector<EntityID>& bucket = m_Buckets[key];
+            m_Slots[entity] = (uint32_t)bucket.size();
+            m_Keys[entity] = key;
+            bucket.push_back(entity);
+        }
+
+        // Swap-remove from the entity's current bucket
+        void Erase(EntityID entity) {
+            std::vector<EntityID>& bucket = m_Buckets[m_Keys[entity]];
+            uint32_t slot = m_Slots[entity];
+            EntityID last = bucket.back();
+            bucket[slot] = last;
+            m_Slots[last] = slot;
+            bucket.pop_back();
+            m_Slots[entity] = UINT32_MAX;
         }
+
+        PoolFor<Component>* m_Pool;
+        std::unordered_map<Key, std::vector<EntityID>> m_Buckets;
+        std::vector<uint32_t> m_Slots;  // Position inside the bucket, by EntityID
+        std::vector<Key> m_Keys;        // Bucket the entity is in, by EntityID
     };
 
 	// The Registry manages all entities and their components
 	// Provides methods to create/destroy entities and add/remove/get components
     class Registry {
     public:
+        // Safe to call from any thread: IDs come from a single atomic counter.
+        // Adding components is NOT thread-safe.
         EntityID CreateEntity() {
-            return m_NextEntityID++;
+            return m_NextEntityID.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Reserves `count` consecutive IDs in one atomic step and returns the first
+        EntityID ReserveEntityBlock(uint32_t count) {
+            return m_NextEntityID.fetch_add(count, std::memory_order_relaxed);
         }
 
         void DestroyEntity(EntityID entity) {
             // Remove this entity from ALL pools
-            for (auto& pair : m_ComponentPools) {
-                pair.second->Remove(entity);
+            for (auto& pool : m_ComponentPools) {
+                if (pool) pool->Remove(entity);
+            }
+        }
+
+        // Pool-major batch destroy: each pool processes the whole list in one pass
+        void DestroyEntities(const std::vector<EntityID>& entities) {
+            if (entities.empty()) return;
+            for (auto& pool : m_ComponentPools) {
+                if (pool) pool->RemoveBatch(entities.data(), entities.size());
+            }
+        }
+
+        // Copies every component of src[i] onto dst[i] (dst entities must already exist)
+        void CloneEntities(const std::vector<EntityID>& src, const std::vector<EntityID>& dst) {
+            AETHER_ASSERT(src.size() == dst.size(), "CloneEntities: source/destination size mismatch");
+            for (auto& pool : m_ComponentPools) {
+                if (pool) pool->CloneBatch(src.data(), dst.data(), src.size());
             }
         }
 
         template<typename T>
         void AddComponent(EntityID entity, T component) {
-            GetPool<T>()->Add(entity, component);
+            if constexpr (IsTagComponent<T>)
+                GetPool<T>()->Add(entity);
+            else
+                GetPool<T>()->Add(entity, component);
         }
 
         template<typename T>
@@ -100,8 +446,24 @@ namespace aether {
             GetPool<T>()->Remove(entity);
         }
 
+        // Modifies a component in place and tells the pool's observers (secondary
+        // indexes) that its values changed. Use for writes to indexed fields.
+        // Usage: registry.Patch<CameraComponent>(id, [](CameraComponent& c) { c.Primary = true; });
+        template<typename T, typename Func>
+        void Patch(EntityID entity, Func&& func) {
+            static_assert(!IsTagComponent<T>, "Tag components have no data to patch");
+            auto* pool = GetPool<T>();
+            uint32_t index = pool->IndexOf(entity);
+            AETHER_ASSERT(index != IPool::InvalidIndex, "Patch: entity {0} does not have component '{1}'!", (uint32_t)entity, typeid(T).name());
+
+            decltype(auto) component = pool->At(index);
+            func(component);
+            pool->NotifyPatched(entity);
+        }
+
+        // Returns T* for regular components, or a pointer-like proxy for custom storage
         template<typename T>
-        T* GetComponent(EntityID entity) {
+        auto GetComponent(EntityID entity) {
             return GetPool<T>()->Get(entity);
         }
 
@@ -111,29 +473,172 @@ namespace aether {
         }
 
         // Returns the raw vector of components for extremely fast iteration
+        // (or the stream struct for custom storage, e.g. TransformStreams)
         template<typename T>
-        std::vector<T>& View() {
+        auto& View() {
+            static_assert(!IsTagComponent<T>, "Tag components have no data to view; use Each<T>() as a filter");
             return GetPool<T>()->Data;
         }
 
         // Returns the list of Entity IDs associated with the components in View()
         // Useful if you need to know WHICH entity owns the component during iteration
+        // (GetOwnerMap<T>()[i] owns View<T>()[i])
         template<typename T>
-        const std::unordered_map<size_t, EntityID>& GetOwnerMap() {
-            return GetPool<T>()->IndexToEntity;
+        const std::vector<EntityID>& GetOwnerMap() {
+            return GetPool<T>()->GetEntities();
+        }
+
+        // --- Multi-Component View ---
+        // Calls func(EntityID, Components&...) for every entity that owns all Include
+        // types and none of the Excluded ones. Tag components act purely as filters and
+        // are not passed to func. Iteration is driven by the smallest included pool and
+        // runs back to front, so func may safely remove the current entity's components.
+        template<typename... Include, typename... Excluded, typename Func>
+        void Each(Func&& func, Exclude<Excluded...> = {}) {
+            static_assert(sizeof...(Include) > 0, "Each<> needs at least one component type");
+
+            std::tuple<PoolFor<Include>*...> pools{ GetPool<Include>()... };
+            std::tuple<PoolFor<Excluded>*...> excluded{ GetPool<Excluded>()... };
+
+            const IPool* driver = nullptr;
+            std::apply([&](auto*... pool) {
+                ((driver = (!driver || pool->Size() < driver->Size()) ? pool : driver), ...);
+                }, pools);
+
+            const std::vector<EntityID>& entities = driver->GetEntities();
+            for (size_t i = entities.size(); i-- > 0; ) {
+                if (i >= entities.size()) continue; // func removed more than the current entity
+                EntityID entity = entities[i];
+
+                bool matches = std::apply([&](auto*... pool) { return (pool->Has(entity) && ...); }, pools)
+                    && std::apply([&](auto*... pool) { return (!pool->Has(entity) && ...); }, excluded);
+                if (!matches) continue;
+
+                std::apply(func, std::tuple_cat(
+                    std::tuple<EntityID>(entity),
+                    ComponentArgs<Include>(std::get<PoolFor<Include>*>(pools), entity)...));
+            }
+        }
+
+        // --- Persistent Queries ---
+        // Registers (or returns the existing) cached query for this component set.
+        // The pointer stays valid for the Registry's lifetime.
+        // Usage: auto* sprites = registry.RegisterQuery<SpriteComponent, TransformComponent>(Exclude<DisabledTag>{});
+        template<typename... Include, typename... Excluded>
+        CachedQuery* RegisterQuery(Exclude<Excluded...> = {}) {
+            static_assert(sizeof...(Include) > 0, "RegisterQuery<> needs at least one component type");
+
+            std::vector<uint32_t> includeIDs{ ComponentTypeIDs::Get<Include>()... };
+            std::vector<uint32_t> excludeIDs{ ComponentTypeIDs::Get<Excluded>()... };
+            std::sort(includeIDs.begin(), includeIDs.end());
+            std::sort(excludeIDs.begin(), excludeIDs.end());
+
+            for (auto& existing : m_Queries) {
+                if (existing->m_IncludeIDs == includeIDs && existing->m_ExcludeIDs == excludeIDs)
+                    return existing.get();
+            }
+
+            auto query = std::make_unique<CachedQuery>();
+            query->m_IncludeIDs = std::move(includeIDs);
+            query->m_ExcludeIDs = std::move(excludeIDs);
+            query->m_Include = { GetPool<Include>()... };
+            query->m_Exclude = { GetPool<Excluded>()... };
+
+            // Initial fill from the smallest include pool; from here on it is incremental
+            const IPool* driver = query->m_Include.front();
+            for (const IPool* pool : query->m_Include)
+                if (pool->Size() < driver->Size()) driver = pool;
+            for (EntityID entity : driver->GetEntities())
+                if (query->Matches(entity)) query->Insert(entity);
+
+            CachedQuery* ptr = query.get();
+            (GetPool<Include>()->AddObserver(ptr), ...);
+            (GetPool<Excluded>()->AddObserver(ptr), ...);
+            m_Queries.push_back(std::move(query));
+            return ptr;
+        }
+
+        // Same contract as Each() above, but walks the query's prebuilt list
+        // instead of testing membership. Include must be the query's include set
+        // (or a subset of it).
+        template<typename... Include, typename Func>
+        void Each(const CachedQuery& query, Func&& func) {
+            std::tuple<PoolFor<Include>*...> pools{ GetPool<Include>()... };
+
+            const std::vector<EntityID>& entities = query.GetEntities();
+            for (size_t i = entities.size(); i-- > 0; ) {
+                if (i >= entities.size()) continue;
+                EntityID entity = entities[i];
+                AETHER_ASSERT(std::apply([&](auto*... pool) { return (pool->Has(entity) && ...); }, pools),
+                    "Each(query): component type is not part of the query's include set");
+
+                std::apply(func, std::tuple_cat(
+                    std::tuple<EntityID>(entity),
+                    ComponentArgs<Include>(std::get<PoolFor<Include>*>(pools), entity)...));
+            }
+        }
+
+        // --- Secondary Indexes ---
+        // Opt-in value index on a component field, built on first use and then
+        // maintained incrementally. Usage: registry.RegisterIndex<&CameraComponent::Primary>();
+        template<auto Member>
+        FieldIndex<Member>* RegisterIndex() {
+            using Component = typename FieldTraits<Member>::Component;
+
+            // Each index type draws an ID from the same counter as components
+            uint32_t indexID = ComponentTypeIDs::Get<FieldIndex<Member>>();
+            if (indexID >= m_FieldIndexes.size())
+                m_FieldIndexes.resize((size_t)indexID + 1);
+
+            auto& slot = m_FieldIndexes[indexID];
+            if (!slot) {
+                auto* pool = GetPool<Component>();
+                auto index = std::make_unique<FieldIndex<Member>>(pool);
+                pool->AddObserver(index.get());
+                slot = std::move(index);
+            }
+            return static_cast<FieldIndex<Member>*>(slot.get());
+        }
+
+        // O(1) bucket lookup; the result lists every entity whose field equals value
+        template<auto Member>
+        const std::vector<EntityID>& FindByField(const typename FieldTraits<Member>::Field& value) {
+            return RegisterIndex<Member>()->Find(value);
+        }
+
+        // Typed pool for T, created on first use. The pointer stays valid for the
+        // Registry's lifetime, so cached accessors (ComponentRef, EntityView) can hold it.
+        template<typename T>
+        PoolFor<T>* GetPool() {
+            uint32_t typeID = ComponentTypeIDs::Get<T>();
+            if (typeID >= m_ComponentPools.size())
+                m_ComponentPools.resize((size_t)typeID + 1);
+
+            auto& pool = m_ComponentPools[typeID];
+            if (!pool)
+                pool = std::make_unique<PoolFor<T>>();
+
+            return static_cast<PoolFor<T>*>(pool.get());
         }
 
     private:
-        EntityID m_NextEntityID = 0;
-        std::unordered_map<std::type_index, std::shared_ptr<IPool>> m_ComponentPools;
+        std::atomic<EntityID> m_NextEntityID{ 0 };
+
+        // Indexed by ComponentTypeIDs::Get<T>(); null for types this Registry never used
+        std::vector<std::unique_ptr<IPool>> m_ComponentPools;
 
+        // Declared after the pools so they are destroyed first
+        std::vector<std::unique_ptr<CachedQuery>> m_Queries;
+        std::vector<std::unique_ptr<IPoolObserver>> m_FieldIndexes; // Indexed by ComponentTypeIDs::Get<FieldIndex<M>>()
+
+        // Tags contribute no argument to Each() callbacks.
+        // Regular components are passed as T&, custom storage as its reference proxy.
         template<typename T>
-        std::shared_ptr<ComponentPool<T>> GetPool() {
-            std::type_index type = std::type_index(typeid(T));
-            if (m_ComponentPools.find(type) == m_ComponentPools.end()) {
-                m_ComponentPools[type] = std::make_shared<ComponentPool<T>>();
-            }
-            return std::static_pointer_cast<ComponentPool<T>>(m_ComponentPools[type]);
+        static auto ComponentArgs(PoolFor<T>* pool, EntityID entity) {
+            if constexpr (IsTagComponent<T>)
+                return std::tuple<>();
+            else
+                return std::tuple<decltype(pool->At(0))>(pool->At(pool->IndexOf(entity)));
         }
     };
 
@@ -0,0 +1,79 @@
+#include "SystemScheduler.h"
+#include "Components.h"
+#include <algorithm>
+
+namespace aether {
+
+    void SystemScheduler::Update(Registry& registry, TimeStep ts, uint64_t tick) {
+        for (auto& system : m_TimeSliced)
+            RunSlice(*system, registry, ts);
+        for (auto& system : m_Ticked)
+            RunTicked(*system, registry, ts, tick);
+    }
+
+    void SystemScheduler::RunTicked(TickedSystem& system, Registry& registry, TimeStep ts, uint64_t tick) {
+        auto* lods = registry.GetPool<SimulationLODComponent>();
+        const std::vector<EntityID>& entities = system.GetEntities(registry);
+
+        // Index loop: Process() may despawn entities and shrink the list
+        for (size_t i = 0; i < entities.size(); i++) {
+            EntityID entity = entities[i];
+            const SimulationLODComponent* lod = lods->Get(entity);
+            if (lod && lod->DueTick != tick) continue;
+            system.Process(registry, entity, ts);
+        }
+    }
+
+    void SystemScheduler::RunSlice(TimeSlicedSystem& system, Registry& registry, TimeStep ts) {
+        TimeSliceStats& stats = system.m_Stats;
+        stats.Processed = 0;
+        stats.HitBudget = false;
+
+        const std::vector<EntityID>& entities = system.GetEntities(registry);
+        if (entities.empty()) {
+            stats.ElapsedMs = 0.0;
+            system.m_Cursor = 0;
+            return;
+        }
+
+        const double start = AetherTime::Now();
+        const double budgetSeconds = system.m_BudgetMs / 1000.0;
+        if (system.m_SweepStart < 0.0)
+            system.m_SweepStart = start;
+        system.m_SweepFrames++;
+
+        // The list may have shrunk since last frame (swap-removes); restart the sweep
+        if (system.m_Cursor >= entities.size())
+            system.m_Cursor = 0;
+
+        auto* dormant = system.IncludesDormant() ? nullptr : registry.GetPool<DormantTag>();
+
+        // Always make progress, even with a zero budget, so coverage latency stays finite
+        size_t count = entities.size();
+        while (stats.Processed < count) {
+            EntityID entity = entities[system.m_Cursor];
+            if (!dormant || !dormant->Has(entity))
+                system.Process(registry, entity, ts);
+            stats.Processed++;
+
+            // Process() may despawn entities: re-read the size before advancing
+            count = std::min(count, entities.size());
+            if (++system.m_Cursor >= entities.size()) {
+                double now = AetherTime::Now();
+                stats.LastSweepFrames = system.m_SweepFrames;
+                stats.LastSweepSeconds = now - system.m_SweepStart;
+                system.m_SweepStart = now;
+                system.m_SweepFrames = 0;
+                system.m_Cursor = 0;
+                break; // At most one full pass per frame
+            }
+
+            if (stats.Processed % ClockCheckInterval == 0 && AetherTime::Now() - start >= budgetSeconds) {
+                stats.HitBudget = true;
+                break;
+            }
+        }
+
+        stats.ElapsedMs = (AetherTime::Now() - start) * 1000.0;
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+#include "Registry.h"
+#include "../core/AetherTime.h"
+#include <vector>
+#include <memory>
+#include <string>
+
+namespace aether {
+
+    struct TimeSliceStats {
+        size_t Processed = 0;           // Entities handled this frame
+        double ElapsedMs = 0.0;         // Time spent this frame
+        bool HitBudget = false;         // Stopped early because the budget ran out
+
+        // Coverage latency: how long the last full pass over every entity took
+        uint32_t LastSweepFrames = 0;
+        double LastSweepSeconds = 0.0;
+    };
+
+    // --- Time-Sliced System ---
+    // Work that does not need to touch every entity every frame (AI re-planning,
+    // spatial index rebuilds, LOD evaluation). Each frame the scheduler walks a
+    // window of GetEntities() until the budget is spent, then resumes there next frame.
+    class TimeSlicedSystem {
+    public:
+        TimeSlicedSystem(std::string name, float budgetMs)
+            : m_Name(std::move(name)), m_BudgetMs(budgetMs) {
+        }
+        virtual ~TimeSlicedSystem() = default;
+
+        // Entities to cycle through, queried every frame (e.g. registry.GetOwnerMap<T>())
+        virtual const std::vector<EntityID>& GetEntities(Registry& registry) = 0;
+        virtual void Process(Registry& registry, EntityID entity, TimeStep ts) = 0;
+
+        // Entities carrying DormantTag are skipped unless this returns true
+        virtual bool IncludesDormant() const { return false; }
+
+        const std::string& GetName() const { return m_Name; }
+        float GetBudgetMs() const { return m_BudgetMs; }
+        void SetBudgetMs(float budgetMs) { m_BudgetMs = budgetMs; }
+        const TimeSliceStats& GetStats() const { return m_Stats; }
+
+    private:
+        friend class SystemScheduler;
+
+        std::string m_Name;
+        float m_BudgetMs;
+
+        size_t m_Cursor = 0;
+        uint32_t m_SweepFrames = 0;
+        double m_SweepStart = -1.0;
+        TimeSliceStats m_Stats;
+    };
+
+    // --- Ticked System ---
+    // Per-tick logic (movement, scripts, AI). The scheduler walks GetEntities() every
+    // tick and hands Process() only the entities due this tick: entities without
+    // SimulationLODComponent always, LOD-managed ones on the ticks their tier
+    // schedules (SimulationLOD::BeginTick), dormant ones never.
+    class TickedSystem {
+    public:
+        explicit TickedSystem(std::string name) : m_Name(std::move(name)) {}
+        virtual ~TickedSystem() = default;
+
+        // Typically a CachedQuery registered with Exclude<DormantTag, DisabledTag>
+        virtual const std::vector<EntityID>& GetEntities(Registry& registry) = 0;
+        virtual void Process(Registry& registry, EntityID entity, TimeStep ts) = 0;
+
+        const std::string& GetName() const { return m_Name; }
+
+    private:
+        std::string m_Name;
+    };
+
+    class SystemScheduler {
+    public:
+        // Entities processed between clock reads. Reading the clock per entity
+        // would cost more than the cheap per-entity work this is meant for.
+        static constexpr size_t ClockCheckInterval = 16;
+
+        // Returns the system so callers can keep a typed pointer to it
+        template<typename T, typename... Args>
+        T* AddTimeSliced(Args&&... args) {
+            auto system = std::make_unique<T>(std::forward<Args>(args)...);
+            T* ptr = system.get();
+            m_TimeSliced.push_back(std::move(system));
+            return ptr;
+        }
+
+        template<typename T, typename... Args>
+        T* AddTicked(Args&&... args) {
+            auto system = std::make_unique<T>(std::forward<Args>(args)...);
+            T* ptr = system.get();
+            m_Ticked.push_back(std::move(system));
+            return ptr;
+        }
+
+        // tick must match the one passed to SimulationLOD::BeginTick this frame
+        void Update(Registry& registry, TimeStep ts, uint64_t tick);
+
+        const std::vector<std::unique_ptr<TimeSlicedSystem>>& GetTimeSliced() const { return m_TimeSliced; }
+        const std::vector<std::unique_ptr<TickedSystem>>& GetTicked() const { return m_Ticked; }
+
+    private:
+        void RunSlice(TimeSlicedSystem& system, Registry& registry, TimeStep ts);
+        void RunTicked(TickedSystem& system, Registry& registry, TimeStep ts, uint64_t tick);
+
+        std::vector<std::unique_ptr<TimeSlicedSystem>> m_TimeSliced;
+        std::vector<std::unique_ptr<TickedSystem>> m_Ticked;
+    };
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include "Registry.h"
+#include "Components.h"
+#include <vector>
+#include <optional>
+#include <cstddef>
+
+namespace aether {
+
+    // --- Transform Reference Proxy ---
+    // Behaves like a TransformComponent& whose members live in separate streams.
+    // Copy it by value ("auto tc = entity.GetComponent<TransformComponent>()"); writes go through.
+    struct TransformRef
+    {
+        float& X;
+        float& Y;
+        float& Rotation;
+        float& ScaleX;
+        float& ScaleY;
+        ReplicationMode& Replication;
+
+        TransformRef& operator=(const TransformComponent& value)
+        {
+            X = value.X;
+            Y = value.Y;
+            Rotation = value.Rotation;
+            ScaleX = value.ScaleX;
+            ScaleY = value.ScaleY;
+            Replication = value.Replication;
+            return *this;
+        }
+
+        // Gathers the fields back into a plain value (for serializers, copies, undo snapshots)
+        operator TransformComponent() const
+        {
+            return { X, Y, Rotation, ScaleX, ScaleY, Replication };
+        }
+    };
+
+    // Pointer-like handle returned by Registry::GetComponent<TransformComponent>()
+    class TransformPtr
+    {
+    public:
+        TransformPtr() = default;
+        TransformPtr(std::nullptr_t) {}
+        explicit TransformPtr(const TransformRef& ref) : m_Ref(ref) {}
+
+        explicit operator bool() const { return m_Ref.has_value(); }
+        bool operator==(std::nullptr_t) const { return !m_Ref.has_value(); }
+
+        TransformRef* operator->() { return &*m_Ref; }
+        TransformRef operator*() const { return *m_Ref; }
+
+    private:
+        std::optional<TransformRef> m_Ref;
+    };
+
+    // --- Transform Streams (SoA) ---
+    // Hot/cold split of TransformComponent: each field is its own contiguous array,
+    // indexed by the pool's dense index. Position-only loops touch just X/Y
+    // (8 entities per 32-byte AVX2 load), and the enum metadata adds no padding.
+    struct TransformStreams
+    {
+        // Hot: position
+        std::vector<float> X;
+        std::vector<float> Y;
+
+        // Warm: orientation and size
+        std::vector<float> Rotation;
+        std::vector<float> ScaleX;
+        std::vector<float> ScaleY;
+
+        // Cold: metadata
+        std::vector<ReplicationMode> Replication;
+
+        size_t size() const { return X.size(); }
+        bool empty() const { return X.empty(); }
+
+        TransformRef operator[](size_t index)
+        {
+            return { X[index], Y[index], Rotation[index], ScaleX[index], ScaleY[index], Replication[index] };
+        }
+
+        void push_back(const TransformComponent& value)
+        {
+            X.push_back(value.X);
+            Y.push_back(value.Y);
+            Rotation.push_back(value.Rotation);
+            ScaleX.push_back(value.ScaleX);
+            ScaleY.push_back(value.ScaleY);
+            Replication.push_back(value.Replication);
+        }
+
+        void pop_back()
+        {
+            X.pop_back();
+            Y.pop_back();
+            Rotation.pop_back();
+            ScaleX.pop_back();
+            ScaleY.pop_back();
+            Replication.pop_back();
+        }
+
+        // Copies slot 'from' into slot 'to' across every stream
+        void MoveSlot(size_t to, size_t from)
+        {
+            X[to] = X[from];
+            Y[to] = Y[from];
+            Rotation[to] = Rotation[from];
+            ScaleX[to] = ScaleX[from];
+            ScaleY[to] = ScaleY[from];
+            Replication[to] = Replication[from];
+        }
+
+        void reserve(size_t capacity)
+        {
+            X.reserve(capacity);
+            Y.reserve(capacity);
+            Rotation.reserve(capacity);
+            ScaleX.reserve(capacity);
+            ScaleY.reserve(capacity);
+            Replication.reserve(capacity);
+        }
+    };
+
+    // --- SoA Transform Pool ---
+    // Same sparse-set membership as ComponentPool, with TransformStreams instead of std::vector<T>.
+    class TransformPool : public IPool
+    {
+    public:
+        TransformStreams Data;
+
+        void Add(EntityID entity, const TransformComponent& component)
+        {
+            if (Has(entity)) {
+                Data[m_Sparse[entity]] = component;
+                NotifyPatched(entity);
+                return;
+            }
+
+            InsertIndex(entity);
+            Data.push_back(component);
+            NotifyInserted(entity);
+        }
+
+        void Remove(EntityID entity) override
+        {
+            if (!Has(entity)) return;
+
+            size_t removedIndex = EraseIndex(entity);
+            size_t lastIndex = Data.size() - 1;
+
+            if (removedIndex != lastIndex)
+                Data.MoveSlot(removedIndex, lastIndex);
+
+            Data.pop_back();
+        }
+
+        void RemoveBatch(const EntityID* entities, size_t count) override
+        {
+            if (Data.empty()) return;
+            for (size_t i = 0; i < count; i++)
+                TransformPool::Remove(entities[i]);
+        }
+
+        void CloneBatch(const EntityID* src, const EntityID* dst, size_t count) override
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                uint32_t index = IndexOf(src[i]);
+                if (index == InvalidIndex) continue;
+                TransformComponent copy = Data[index];
+                Add(dst[i], copy);
+            }
+        }
+
+        TransformPtr Get(EntityID entity)
+        {
+            uint32_t index = IndexOf(entity);
+            if (index == InvalidIndex) return nullptr;
+            return TransformPtr(Data[index]);
+        }
+
+        TransformRef At(size_t index) { return Data[index]; }
+    };
+
+    template<>
+    struct StorageTraits<TransformComponent> {
+        using Pool = TransformPool;
+    };
+}
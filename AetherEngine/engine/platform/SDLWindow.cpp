@@ -82,7 +82,21 @@ namespace aether {
         SDL_SetWindowTitle(m_Window, title.c_str());
     }
 
-    void SDLWindow::OnUpdate() {
+    void SDLWindow::MakeContextCurrent() {
+        if (SDL_GL_MakeCurrent(m_Window, m_Context) != 0) {
+            AETHER_CORE_ERROR("SDL_GL_MakeCurrent failed: {0}", SDL_GetError());
+        }
+    }
+
+    void SDLWindow::ReleaseContext() {
+        SDL_GL_MakeCurrent(m_Window, nullptr);
+    }
+
+    void SDLWindow::SwapBuffers() {
+        SDL_GL_SwapWindow(m_Window);
+    }
+
+    void SDLWindow::PollEvents() {
         SDL_Event event;
 
         while (SDL_PollEvent(&event)) {
@@ -154,8 +168,6 @@ namespace aether {
                 }
             }
         }
-
-        SDL_GL_SwapWindow((SDL_Window*)m_Window);
     }
 
     void SDLWindow::SetVsync(bool enabled) {
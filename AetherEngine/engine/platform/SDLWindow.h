@@ -13,7 +13,10 @@ namespace aether {
         SDLWindow(const WindowProps& props);
         virtual ~SDLWindow();
 
-        void OnUpdate() override;
+        void PollEvents() override;
+        void MakeContextCurrent() override;
+        void ReleaseContext() override;
+        void SwapBuffers() override;
         virtual void Clear() const override;
 
 		virtual void SetTitle(const std::string& title) override;
@@ -36,9 +36,18 @@ namespace aether {
     public:
         virtual ~Window() = default;
 
-        virtual void OnUpdate() = 0;
+        // Dispatches pending OS events to the event callback (main thread)
+        virtual void PollEvents() = 0;
 
         // --- Render Context Abstraction ---
+        // The context is current on at most one thread at a time. The window creates it
+        // current on the main thread; RenderThread moves it between the main and render threads.
+        virtual void MakeContextCurrent() = 0;
+        virtual void ReleaseContext() = 0;
+
+        // Presents the back buffer; call on the thread the context is current on
+        virtual void SwapBuffers() = 0;
+
         // Engine calls this to clear the screen at the start of a frame.
         // This removes the need for OpenGL headers in Engine.cpp
         virtual void Clear() const = 0;
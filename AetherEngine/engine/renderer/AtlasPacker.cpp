@@ -0,0 +1,159 @@
+#include "AtlasPacker.h"
+#include <algorithm>
+#include <limits>
+
+namespace aether {
+
+    SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+        : m_Width(width), m_Height(height)
+    {
+        m_Skyline.push_back({ 0, 0, width });
+    }
+
+    bool SkylinePacker::Fit(size_t index, uint32_t width, uint32_t height, uint32_t& outY) const
+    {
+        uint32_t x = m_Skyline[index].X;
+        if (x + width > m_Width)
+            return false;
+
+        // The rectangle rests on the highest segment it spans
+        uint32_t y = 0;
+        uint32_t remaining = width;
+        for (size_t i = index; remaining > 0; i++)
+        {
+            if (i >= m_Skyline.size())
+                return false;
+            y = std::max(y, m_Skyline[i].Y);
+            if (y + height > m_Height)
+                return false;
+            remaining -= std::min(remaining, m_Skyline[i].Width);
+        }
+
+        outY = y;
+        return true;
+    }
+
+    bool SkylinePacker::Pack(uint32_t width, uint32_t height, AtlasRect& outRect)
+    {
+        if (width == 0 || height == 0)
+            return false;
+
+        size_t bestIndex = SIZE_MAX;
+        uint32_t bestY = std::numeric_limits<uint32_t>::max();
+        uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+
+        for (size_t i = 0; i < m_Skyline.size(); i++)
+        {
+            uint32_t y;
+            if (!Fit(i, width, height, y))
+                continue;
+
+            uint32_t top = y + height;
+            if (top < bestY || (top == bestY && m_Skyline[i].Width < bestWidth))
+            {
+                bestIndex = i;
+                bestY = top;
+                bestWidth = m_Skyline[i].Width;
+                outRect = { m_Skyline[i].X, y, width, height };
+            }
+        }
+
+        if (bestIndex == SIZE_MAX)
+            return false;
+
+        AddLevel(bestIndex, outRect);
+        m_UsedArea += (uint64_t)width * height;
+        return true;
+    }
+
+    void SkylinePacker::AddLevel(size_t index, const AtlasRect& rect)
+    {
+        m_Skyline.insert(m_Skyline.begin() + index, { rect.X, rect.Y + rect.Height, rect.Width });
+
+        // Trim or remove the segments now covered by the new one
+        for (size_t i = index + 1; i < m_Skyline.size(); )
+        {
+            Segment& previous = m_Skyline[i - 1];
+            Segment& current = m_Skyline[i];
+            uint32_t previousEnd = previous.X + previous.Width;
+            if (current.X >= previousEnd)
+                break;
+
+            uint32_t shrink = previousEnd - current.X;
+            if (current.Width <= shrink)
+            {
+                m_Skyline.erase(m_Skyline.begin() + i);
+                continue;
+            }
+            current.X += shrink;
+            current.Width -= shrink;
+            break;
+        }
+
+        // Merge neighbours at the same height
+        for (size_t i = 0; i + 1 < m_Skyline.size(); )
+        {
+            if (m_Skyline[i].Y == m_Skyline[i + 1].Y)
+            {
+                m_Skyline[i].Width += m_Skyline[i + 1].Width;
+                m_Skyline.erase(m_Skyline.begin() + i + 1);
+            }
+            else
+            {
+                i++;
+            }
+        }
+    }
+
+    float SkylinePacker::GetOccupancy() const
+    {
+        return (float)((double)m_UsedArea / ((double)m_Width * m_Height));
+    }
+
+    AtlasLayout PackAtlas(std::vector<AtlasPackInput> inputs, uint32_t pageWidth, uint32_t pageHeight, uint32_t padding)
+    {
+        AtlasLayout layout;
+        layout.PageWidth = pageWidth;
+        layout.PageHeight = pageHeight;
+
+        // Tallest (then widest) first gives the skyline the flattest profile
+        std::sort(inputs.begin(), inputs.end(), [](const AtlasPackInput& a, const AtlasPackInput& b) {
+            return a.Height != b.Height ? a.Height > b.Height : a.Width > b.Width;
+        });
+
+        std::vector<SkylinePacker> pages;
+        for (const AtlasPackInput& input : inputs)
+        {
+            uint32_t paddedWidth = input.Width + padding * 2;
+            uint32_t paddedHeight = input.Height + padding * 2;
+            if (paddedWidth > pageWidth || paddedHeight > pageHeight)
+            {
+                layout.Rejected.push_back(input.ID);
+                continue;
+            }
+
+            AtlasRect rect;
+            uint32_t page = 0;
+            for (; page < pages.size(); page++)
+            {
+                if (pages[page].Pack(paddedWidth, paddedHeight, rect))
+                    break;
+            }
+            if (page == pages.size())
+            {
+                pages.emplace_back(pageWidth, pageHeight);
+                pages.back().Pack(paddedWidth, paddedHeight, rect);
+            }
+
+            AtlasPlacement placement;
+            placement.ID = input.ID;
+            placement.Page = page;
+            placement.Rect = { rect.X + padding, rect.Y + padding, input.Width, input.Height };
+            layout.Placements.push_back(placement);
+        }
+
+        layout.PageCount = (uint32_t)pages.size();
+        return layout;
+    }
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aether {
+
+    struct AtlasRect
+    {
+        uint32_t X = 0, Y = 0;
+        uint32_t Width = 0, Height = 0;
+    };
+
+    // --- Skyline Packer ---
+    // Bottom-left skyline bin packing for one atlas page. Tracks the top edge of
+    // the packed area as a list of horizontal segments and drops each rectangle
+    // where it ends lowest (ties: narrowest waste). Pure CPU, no GL.
+    class SkylinePacker
+    {
+    public:
+        SkylinePacker(uint32_t width, uint32_t height);
+
+        // Places a width x height rectangle; false if it does not fit on this page
+        bool Pack(uint32_t width, uint32_t height, AtlasRect& outRect);
+
+        uint32_t GetWidth() const { return m_Width; }
+        uint32_t GetHeight() const { return m_Height; }
+
+        // Packed area / page area
+        float GetOccupancy() const;
+
+    private:
+        struct Segment
+        {
+            uint32_t X, Y, Width;
+        };
+
+        // Lowest Y at which a rectangle of `width` can sit starting at segment `index`
+        bool Fit(size_t index, uint32_t width, uint32_t height, uint32_t& outY) const;
+        void AddLevel(size_t index, const AtlasRect& rect);
+
+        uint32_t m_Width, m_Height;
+        uint64_t m_UsedArea = 0;
+        std::vector<Segment> m_Skyline;
+    };
+
+    // --- Multi-Page Atlas Layout ---
+    // Packs a set of images (tallest first) into as many pages as needed.
+    struct AtlasPackInput
+    {
+        uint64_t ID = 0; // Caller's key (the texture asset UUID)
+        uint32_t Width = 0, Height = 0;
+    };
+
+    struct AtlasPlacement
+    {
+        uint64_t ID = 0;
+        uint32_t Page = 0;
+        AtlasRect Rect; // Excludes padding
+    };
+
+    struct AtlasLayout
+    {
+        uint32_t PageWidth = 0, PageHeight = 0;
+        uint32_t PageCount = 0;
+        std::vector<AtlasPlacement> Placements;
+        std::vector<uint64_t> Rejected; // Larger than a page
+    };
+
+    // padding: empty pixels kept between neighbours to stop filtering from bleeding
+    AtlasLayout PackAtlas(std::vector<AtlasPackInput> inputs, uint32_t pageWidth, uint32_t pageHeight, uint32_t padding = 2);
+
+}
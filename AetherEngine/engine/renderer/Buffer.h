@@ -82,6 +82,10 @@ namespace aether {
         uint32_t GetStride() const { return m_Stride; }
         const std::vector<BufferElement>& GetElements() const { return m_Elements; }
 
+        // 0 = advance per vertex, N = advance once every N instances (glVertexAttribDivisor)
+        uint32_t GetDivisor() const { return m_Divisor; }
+        void SetDivisor(uint32_t divisor) { m_Divisor = divisor; }
+
         std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
         std::vector<BufferElement>::iterator end() { return m_Elements.end(); }
         std::vector<BufferElement>::const_iterator begin() const { return m_Elements.begin(); }
@@ -102,6 +106,7 @@ namespace aether {
 
         std::vector<BufferElement> m_Elements;
         uint32_t m_Stride = 0;
+        uint32_t m_Divisor = 0;
     };
 
     // --- Vertex Buffer ---
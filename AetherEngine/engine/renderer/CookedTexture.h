@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace aether {
+
+    // --- Cooked Texture (.aetex) ---
+    // Written offline by TextureCooker, read by Texture2D with no image decoding:
+    //
+    //   CookedTextureHeader | MipCount levels of RGBA8, largest first
+    //
+    // Each level is max(1, Width >> i) x max(1, Height >> i) pixels, tightly packed,
+    // bottom row first (GL order, like the atlas pages).
+    struct CookedTextureHeader
+    {
+        static constexpr uint32_t CurrentVersion = 1;
+
+        enum Flags : uint32_t
+        {
+            PremultipliedAlpha = 1 << 0
+        };
+
+        char Magic[4] = { 'A', 'E', 'T', 'X' };
+        uint32_t Version = CurrentVersion;
+        uint32_t Width = 0;
+        uint32_t Height = 0;
+        uint32_t MipCount = 0;
+        uint32_t Flags = 0;
+
+        bool IsValid() const
+        {
+            return Magic[0] == 'A' && Magic[1] == 'E' && Magic[2] == 'T' && Magic[3] == 'X'
+                && Version == CurrentVersion && Width && Height
+                && MipCount >= 1 && MipCount <= GetFullMipCount(Width, Height);
+        }
+
+        // Levels down to 1x1
+        static uint32_t GetFullMipCount(uint32_t width, uint32_t height)
+        {
+            uint32_t levels = 1;
+            for (uint32_t size = std::max(width, height); size > 1; size >>= 1)
+                levels++;
+            return levels;
+        }
+
+        static uint32_t GetMipDimension(uint32_t size, uint32_t level) { return std::max(1u, size >> level); }
+
+        static size_t GetMipSize(uint32_t width, uint32_t height, uint32_t level)
+        {
+            return (size_t)GetMipDimension(width, level) * GetMipDimension(height, level) * 4;
+        }
+    };
+
+}
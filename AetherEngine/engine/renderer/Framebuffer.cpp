@@ -1,4 +1,5 @@
 #include "Framebuffer.h"
+#include "GLStateCache.h"
 #include "../core/Log.h"
 #include "../vendor/glad/include/glad/glad.h"
 
@@ -41,6 +42,9 @@ namespace aether {
 
     OpenGLFramebuffer::~OpenGLFramebuffer()
     {
+        GLStateCache::OnFramebufferDeleted(m_RendererID);
+        GLStateCache::OnTextureDeleted(m_ColorAttachment);
+        GLStateCache::OnTextureDeleted(m_DepthAttachment);
         glDeleteFramebuffers(1, &m_RendererID);
         glDeleteTextures(1, &m_ColorAttachment);
         glDeleteTextures(1, &m_DepthAttachment);
@@ -50,47 +54,46 @@ namespace aether {
     {
         if (m_RendererID)
         {
+            GLStateCache::OnFramebufferDeleted(m_RendererID);
+            GLStateCache::OnTextureDeleted(m_ColorAttachment);
+            GLStateCache::OnTextureDeleted(m_DepthAttachment);
             glDeleteFramebuffers(1, &m_RendererID);
             glDeleteTextures(1, &m_ColorAttachment);
             glDeleteTextures(1, &m_DepthAttachment);
         }
 
+        // Built with DSA: nothing is bound, so the state cache stays accurate
         glCreateFramebuffers(1, &m_RendererID);
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
 
         // 1. Color Attachment (Texture)
         glCreateTextures(GL_TEXTURE_2D, 1, &m_ColorAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_ColorAttachment);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_Specification.Width, m_Specification.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glTextureStorage2D(m_ColorAttachment, 1, GL_RGBA8, m_Specification.Width, m_Specification.Height);
 
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+        glTextureParameteri(m_ColorAttachment, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_ColorAttachment, 0);
+        glNamedFramebufferTexture(m_RendererID, GL_COLOR_ATTACHMENT0, m_ColorAttachment, 0);
 
-        // 2. Depth/Stencil Attachment (Renderbuffer)
+        // 2. Depth/Stencil Attachment
         glCreateTextures(GL_TEXTURE_2D, 1, &m_DepthAttachment);
-        glBindTexture(GL_TEXTURE_2D, m_DepthAttachment);
-        glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_DepthAttachment, 0);
+        glTextureStorage2D(m_DepthAttachment, 1, GL_DEPTH24_STENCIL8, m_Specification.Width, m_Specification.Height);
+        glNamedFramebufferTexture(m_RendererID, GL_DEPTH_STENCIL_ATTACHMENT, m_DepthAttachment, 0);
 
         // Validation
-        AETHER_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        AETHER_ASSERT(glCheckNamedFramebufferStatus(m_RendererID, GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
     }
 
     void OpenGLFramebuffer::Bind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+        GLStateCache::BindFramebuffer(m_RendererID);
         glViewport(0, 0, m_Specification.Width, m_Specification.Height);
     }
 
     void OpenGLFramebuffer::Unbind()
     {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        GLStateCache::BindFramebuffer(0);
     }
 
     void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height)
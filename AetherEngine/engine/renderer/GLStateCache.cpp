@@ -0,0 +1,154 @@
+#include "GLStateCache.h"
+#include "../core/Log.h"
+#include <glad/glad.h>
+
+namespace aether {
+
+    // Sentinels that never match a real value, so the first call after Invalidate() is issued
+    static constexpr uint32_t UnknownName = 0xffffffff;
+    static constexpr int8_t UnknownFlag = -1;
+
+    struct GLStateData
+    {
+        uint32_t Program = UnknownName;
+        uint32_t VertexArray = UnknownName;
+        uint32_t Framebuffer = UnknownName;
+        uint32_t Textures[GLStateCache::MaxTextureUnits];
+
+        int8_t Blend = UnknownFlag;
+        uint32_t BlendSource = UnknownName;
+        uint32_t BlendDestination = UnknownName;
+        int8_t DepthTest = UnknownFlag;
+        int8_t DepthWrite = UnknownFlag;
+
+        GLStateCache::Statistics Stats;
+
+        GLStateData() { ForgetAll(); }
+
+        void ForgetAll()
+        {
+            Program = VertexArray = Framebuffer = UnknownName;
+            for (uint32_t& texture : Textures) texture = UnknownName;
+            Blend = DepthTest = DepthWrite = UnknownFlag;
+            BlendSource = BlendDestination = UnknownName;
+        }
+    };
+
+    static GLStateData s_State;
+
+    // True (and counted as issued) if cached != value; the caller then makes the GL call
+    template<typename T>
+    static bool Changes(T& cached, T value)
+    {
+        if (cached == value)
+        {
+            s_State.Stats.Elided++;
+            return false;
+        }
+        cached = value;
+        s_State.Stats.Issued++;
+        return true;
+    }
+
+    void GLStateCache::UseProgram(uint32_t program)
+    {
+        if (Changes(s_State.Program, program))
+            glUseProgram(program);
+    }
+
+    void GLStateCache::BindVertexArray(uint32_t vertexArray)
+    {
+        if (Changes(s_State.VertexArray, vertexArray))
+            glBindVertexArray(vertexArray);
+    }
+
+    void GLStateCache::BindTextureUnit(uint32_t unit, uint32_t texture)
+    {
+        if (unit >= MaxTextureUnits)
+        {
+            glBindTextureUnit(unit, texture);
+            s_State.Stats.Issued++;
+            return;
+        }
+
+        if (Changes(s_State.Textures[unit], texture))
+            glBindTextureUnit(unit, texture);
+    }
+
+    void GLStateCache::BindFramebuffer(uint32_t framebuffer)
+    {
+        if (Changes(s_State.Framebuffer, framebuffer))
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    }
+
+    void GLStateCache::SetBlend(bool enabled)
+    {
+        if (Changes(s_State.Blend, (int8_t)enabled))
+            enabled ? glEnable(GL_BLEND) : glDisable(GL_BLEND);
+    }
+
+    void GLStateCache::SetBlendFunc(uint32_t source, uint32_t destination)
+    {
+        if (s_State.BlendSource == source && s_State.BlendDestination == destination)
+        {
+            s_State.Stats.Elided++;
+            return;
+        }
+
+        s_State.BlendSource = source;
+        s_State.BlendDestination = destination;
+        s_State.Stats.Issued++;
+        glBlendFunc(source, destination);
+    }
+
+    void GLStateCache::SetDepthTest(bool enabled)
+    {
+        if (Changes(s_State.DepthTest, (int8_t)enabled))
+            enabled ? glEnable(GL_DEPTH_TEST) : glDisable(GL_DEPTH_TEST);
+    }
+
+    void GLStateCache::SetDepthWrite(bool enabled)
+    {
+        if (Changes(s_State.DepthWrite, (int8_t)enabled))
+            glDepthMask(enabled ? GL_TRUE : GL_FALSE);
+    }
+
+    void GLStateCache::OnProgramDeleted(uint32_t program)
+    {
+        if (s_State.Program == program) s_State.Program = UnknownName;
+    }
+
+    void GLStateCache::OnVertexArrayDeleted(uint32_t vertexArray)
+    {
+        if (s_State.VertexArray == vertexArray) s_State.VertexArray = UnknownName;
+    }
+
+    void GLStateCache::OnTextureDeleted(uint32_t texture)
+    {
+        for (uint32_t& bound : s_State.Textures)
+        {
+            if (bound == texture) bound = UnknownName;
+        }
+    }
+
+    void GLStateCache::OnFramebufferDeleted(uint32_t framebuffer)
+    {
+        if (s_State.Framebuffer == framebuffer) s_State.Framebuffer = UnknownName;
+    }
+
+    void GLStateCache::Invalidate()
+    {
+        s_State.ForgetAll();
+    }
+
+    const GLStateCache::Statistics& GLStateCache::GetStats()
+    {
+        return s_State.Stats;
+    }
+
+    void GLStateCache::ResetStats()
+    {
+        s_State.Stats = {};
+    }
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+
+namespace aether {
+
+    // --- GL State Cache ---
+    // Shadows the bind and fixed-function state the engine sets, and drops calls that
+    // would not change anything. Every engine bind goes through here; code that talks
+    // to GL directly (ImGui's backend) must be followed by Invalidate().
+    class GLStateCache
+    {
+    public:
+        static constexpr uint32_t MaxTextureUnits = 32;
+
+        static void UseProgram(uint32_t program);
+        static void BindVertexArray(uint32_t vertexArray);
+        static void BindTextureUnit(uint32_t unit, uint32_t texture);
+        static void BindFramebuffer(uint32_t framebuffer);
+
+        static void SetBlend(bool enabled);
+        static void SetBlendFunc(uint32_t source, uint32_t destination);
+        static void SetDepthTest(bool enabled);
+        static void SetDepthWrite(bool enabled);
+
+        // GL recycles names: forget deleted objects so a new one with the same name still binds
+        static void OnProgramDeleted(uint32_t program);
+        static void OnVertexArrayDeleted(uint32_t vertexArray);
+        static void OnTextureDeleted(uint32_t texture);
+        static void OnFramebufferDeleted(uint32_t framebuffer);
+
+        // Forget everything; the next call of each kind is always issued
+        static void Invalidate();
+
+        // --- Statistics ---
+        // Accumulate until ResetStats(), like Renderer2D::Statistics
+        struct Statistics
+        {
+            uint32_t Issued = 0;
+            uint32_t Elided = 0;
+        };
+
+        static const Statistics& GetStats();
+        static void ResetStats();
+    };
+
+}
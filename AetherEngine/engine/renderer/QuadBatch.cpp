@@ -0,0 +1,73 @@
+#include "QuadBatch.h"
+#include "../core/Log.h"
+
+namespace aether {
+
+    QuadBatch::QuadBatch(uint32_t maxQuads, uint32_t maxTextureSlots)
+        : m_MaxQuads(maxQuads)
+    {
+        AETHER_ASSERT(maxQuads > 0 && maxTextureSlots > 0, "QuadBatch: needs at least one quad and one texture slot");
+        m_Vertices.resize((size_t)maxQuads * 4);
+        m_TextureSlots.resize(maxTextureSlots, 0);
+    }
+
+    void QuadBatch::Reset(uint32_t whiteTextureID)
+    {
+        m_QuadCount = 0;
+        m_TextureSlots[0] = whiteTextureID;
+        m_TextureSlotCount = 1;
+    }
+
+    int QuadBatch::AcquireTextureSlot(uint32_t textureID)
+    {
+        // Few slots: a linear scan beats any lookup structure here
+        for (uint32_t i = 0; i < m_TextureSlotCount; i++)
+        {
+            if (m_TextureSlots[i] == textureID)
+                return (int)i;
+        }
+
+        if (m_TextureSlotCount >= m_TextureSlots.size())
+            return InvalidSlot;
+
+        m_TextureSlots[m_TextureSlotCount] = textureID;
+        return (int)m_TextureSlotCount++;
+    }
+
+    void QuadBatch::AddQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, int textureSlot, float tiling)
+    {
+        AETHER_ASSERT(!IsFull(), "QuadBatch: AddQuad on a full batch (flush first)");
+
+        const float x0 = position.x - size.x * 0.5f;
+        const float y0 = position.y - size.y * 0.5f;
+        const float x1 = position.x + size.x * 0.5f;
+        const float y1 = position.y + size.y * 0.5f;
+        const float texIndex = (float)textureSlot;
+
+        QuadVertex* v = &m_Vertices[(size_t)m_QuadCount * 4];
+        v[0] = { { x0, y0, 0.0f }, color, { 0.0f,   0.0f   }, texIndex };
+        v[1] = { { x1, y0, 0.0f }, color, { tiling, 0.0f   }, texIndex };
+        v[2] = { { x1, y1, 0.0f }, color, { tiling, tiling }, texIndex };
+        v[3] = { { x0, y1, 0.0f }, color, { 0.0f,   tiling }, texIndex };
+
+        m_QuadCount++;
+    }
+
+    std::vector<uint32_t> QuadBatch::GenerateIndices(uint32_t maxQuads)
+    {
+        std::vector<uint32_t> indices((size_t)maxQuads * 6);
+        uint32_t offset = 0;
+        for (size_t i = 0; i < indices.size(); i += 6)
+        {
+            indices[i + 0] = offset + 0;
+            indices[i + 1] = offset + 1;
+            indices[i + 2] = offset + 2;
+            indices[i + 3] = offset + 2;
+            indices[i + 4] = offset + 3;
+            indices[i + 5] = offset + 0;
+            offset += 4;
+        }
+        return indices;
+    }
+
+}
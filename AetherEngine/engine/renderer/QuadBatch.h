@@ -0,0 +1,67 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace aether {
+
+    // One corner of a batched quad. Layout must match Renderer2D_Quad.glsl.
+    struct QuadVertex
+    {
+        glm::vec3 Position;
+        glm::vec4 Color;
+        glm::vec2 TexCoord;
+        float TexIndex;
+    };
+
+    // --- Quad Batch ---
+    // CPU side of the batched renderer: builds vertices and tracks texture slots.
+    // Contains no GL calls, so vertex generation can be profiled without a GPU.
+    // Renderer2D uploads GetVertices() and draws with a static index buffer
+    // (see GenerateIndices) whenever the batch reports it is full.
+    class QuadBatch
+    {
+    public:
+        static constexpr uint32_t DefaultMaxQuads = 20000;
+        static constexpr uint32_t DefaultMaxTextureSlots = 16; // GL guarantees at least 16 fragment units
+        static constexpr int InvalidSlot = -1;
+
+        QuadBatch(uint32_t maxQuads = DefaultMaxQuads, uint32_t maxTextureSlots = DefaultMaxTextureSlots);
+
+        // Clears quads and texture slots; slot 0 is always the white texture
+        void Reset(uint32_t whiteTextureID);
+
+        bool IsFull() const { return m_QuadCount >= m_MaxQuads; }
+        bool IsEmpty() const { return m_QuadCount == 0; }
+
+        // Slot for the texture, assigning a new one if needed. InvalidSlot means
+        // every slot is taken and the batch must be flushed first.
+        int AcquireTextureSlot(uint32_t textureID);
+
+        // Axis-aligned quad centred on position. Caller must check IsFull() first.
+        void AddQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color, int textureSlot = 0, float tiling = 1.0f);
+
+        const QuadVertex* GetVertices() const { return m_Vertices.data(); }
+        uint32_t GetVertexDataSize() const { return m_QuadCount * 4 * (uint32_t)sizeof(QuadVertex); }
+        uint32_t GetQuadCount() const { return m_QuadCount; }
+        uint32_t GetIndexCount() const { return m_QuadCount * 6; }
+
+        const uint32_t* GetTextureSlots() const { return m_TextureSlots.data(); }
+        uint32_t GetTextureSlotCount() const { return m_TextureSlotCount; }
+
+        uint32_t GetMaxQuads() const { return m_MaxQuads; }
+
+        // 0,1,2, 2,3,0 per quad; built once and uploaded as a static index buffer
+        static std::vector<uint32_t> GenerateIndices(uint32_t maxQuads);
+
+    private:
+        uint32_t m_MaxQuads;
+        uint32_t m_QuadCount = 0;
+        std::vector<QuadVertex> m_Vertices; // Sized once, never reallocated
+
+        std::vector<uint32_t> m_TextureSlots;
+        uint32_t m_TextureSlotCount = 1;
+    };
+
+}
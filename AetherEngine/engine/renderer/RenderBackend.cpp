@@ -0,0 +1,92 @@
+#include "RenderBackend.h"
+#include "Renderer2D.h"
+#include "Framebuffer.h"
+#include "../platform/Window.h"
+#include "../core/Log.h"
+#include "../vendor/glad/include/glad/glad.h"
+
+namespace aether {
+
+    void RenderBackend::Execute(const RenderCommandBuffer& commands)
+    {
+        commands.ForEach([this](const RenderCommandHeader& header, const void* payload)
+            {
+                switch (header.Type)
+                {
+                case RenderCommandType::BeginScene:
+                    OnBeginScene(*static_cast<const BeginSceneCommand*>(payload));
+                    break;
+                case RenderCommandType::DrawInstances:
+                    OnDrawInstances(*static_cast<const DrawInstancesCommand*>(payload));
+                    break;
+                case RenderCommandType::EndScene:
+                    OnEndScene();
+                    break;
+                case RenderCommandType::BindFramebuffer:
+                    OnBindFramebuffer(*static_cast<const FramebufferCommand*>(payload));
+                    break;
+                case RenderCommandType::UnbindFramebuffer:
+                    OnUnbindFramebuffer(*static_cast<const FramebufferCommand*>(payload));
+                    break;
+                case RenderCommandType::Present:
+                    OnPresent();
+                    break;
+                default:
+                    AETHER_CORE_ERROR("RenderBackend: unknown command type {0}", (uint32_t)header.Type);
+                    break;
+                }
+            });
+    }
+
+    // --- Renderer2D ---
+
+    Renderer2DBackend::Renderer2DBackend(Window& window, std::function<void()> overlayPass)
+        : m_Window(window), m_OverlayPass(std::move(overlayPass))
+    {
+    }
+
+    void Renderer2DBackend::MakeContextCurrent()
+    {
+        m_Window.MakeContextCurrent();
+    }
+
+    void Renderer2DBackend::ReleaseContext()
+    {
+        m_Window.ReleaseContext();
+    }
+
+    void Renderer2DBackend::OnBeginScene(const BeginSceneCommand& command)
+    {
+        Renderer2D::BeginScene(command.ViewProjection);
+    }
+
+    void Renderer2DBackend::OnDrawInstances(const DrawInstancesCommand& command)
+    {
+        Renderer2D::DrawInstances(command.GetInstances(), command.Count, command.Texture);
+    }
+
+    void Renderer2DBackend::OnEndScene()
+    {
+        Renderer2D::EndScene();
+    }
+
+    void Renderer2DBackend::OnBindFramebuffer(const FramebufferCommand& command)
+    {
+        command.Target->Bind();
+        glClearColor(command.ClearColor.r, command.ClearColor.g, command.ClearColor.b, command.ClearColor.a);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    }
+
+    void Renderer2DBackend::OnUnbindFramebuffer(const FramebufferCommand& command)
+    {
+        command.Target->Unbind();
+    }
+
+    void Renderer2DBackend::OnPresent()
+    {
+        if (m_OverlayPass)
+            m_OverlayPass();
+        m_Window.SwapBuffers();
+    }
+
+}
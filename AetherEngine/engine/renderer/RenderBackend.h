@@ -0,0 +1,58 @@
+#pragma once
+
+#include "RenderCommandBuffer.h"
+#include <functional>
+
+namespace aether {
+
+    class Window;
+
+    // --- Render Backend ---
+    // Consumes a recorded command stream. Execute() decodes the commands and
+    // dispatches to the handlers, so backends only deal with typed data.
+    class RenderBackend
+    {
+    public:
+        virtual ~RenderBackend() = default;
+
+        void Execute(const RenderCommandBuffer& commands);
+
+        // Binds / unbinds the GPU context on the calling thread. RenderThread calls these
+        // around every packet it executes and when the producer takes the context back.
+        virtual void MakeContextCurrent() {}
+        virtual void ReleaseContext() {}
+
+    protected:
+        virtual void OnBeginScene(const BeginSceneCommand& command) = 0;
+        virtual void OnDrawInstances(const DrawInstancesCommand& command) = 0;
+        virtual void OnEndScene() = 0;
+        virtual void OnBindFramebuffer(const FramebufferCommand& command) = 0;
+        virtual void OnUnbindFramebuffer(const FramebufferCommand& command) = 0;
+        virtual void OnPresent() = 0;
+    };
+
+    // Forwards to Renderer2D and presents to the window whose GL context it borrows.
+    // overlayPass runs right before the swap, on the executing thread (the editor's
+    // ImGui draw data); it may be empty.
+    class Renderer2DBackend : public RenderBackend
+    {
+    public:
+        Renderer2DBackend(Window& window, std::function<void()> overlayPass = {});
+
+        virtual void MakeContextCurrent() override;
+        virtual void ReleaseContext() override;
+
+    protected:
+        virtual void OnBeginScene(const BeginSceneCommand& command) override;
+        virtual void OnDrawInstances(const DrawInstancesCommand& command) override;
+        virtual void OnEndScene() override;
+        virtual void OnBindFramebuffer(const FramebufferCommand& command) override;
+        virtual void OnUnbindFramebuffer(const FramebufferCommand& command) override;
+        virtual void OnPresent() override;
+
+    private:
+        Window& m_Window;
+        std::function<void()> m_OverlayPass;
+    };
+
+}
@@ -0,0 +1,70 @@
+#include "RenderCommandBuffer.h"
+#include <cstring>
+#include <algorithm>
+
+namespace aether {
+
+    static size_t AlignCommandSize(size_t size)
+    {
+        return (size + RenderCommandBuffer::CommandAlignment - 1) & ~(RenderCommandBuffer::CommandAlignment - 1);
+    }
+
+    void* RenderCommandBuffer::Allocate(RenderCommandType type, size_t payloadSize)
+    {
+        size_t commandSize = AlignCommandSize(sizeof(RenderCommandHeader) + payloadSize);
+
+        // Grow geometrically; steady-state frames fit in the capacity left by earlier ones
+        if (m_Size + commandSize > m_Data.size())
+            m_Data.resize(std::max(m_Data.size() * 2, m_Size + commandSize));
+
+        auto* header = reinterpret_cast<RenderCommandHeader*>(m_Data.data() + m_Size);
+        header->Type = type;
+        header->Size = (uint32_t)commandSize;
+
+        m_Size += commandSize;
+        m_CommandCount++;
+        return header + 1;
+    }
+
+    void RenderCommandBuffer::BeginScene(const glm::mat4& viewProjection)
+    {
+        auto* command = static_cast<BeginSceneCommand*>(Allocate(RenderCommandType::BeginScene, sizeof(BeginSceneCommand)));
+        command->ViewProjection = viewProjection;
+    }
+
+    void RenderCommandBuffer::DrawInstances(const Texture2D* texture, const SpriteInstance* instances, uint32_t count)
+    {
+        if (count == 0) return;
+
+        size_t instanceBytes = (size_t)count * sizeof(SpriteInstance);
+        auto* command = static_cast<DrawInstancesCommand*>(Allocate(RenderCommandType::DrawInstances, sizeof(DrawInstancesCommand) + instanceBytes));
+        command->Texture = texture;
+        command->Count = count;
+        std::memcpy(command + 1, instances, instanceBytes);
+    }
+
+    void RenderCommandBuffer::EndScene()
+    {
+        Allocate(RenderCommandType::EndScene, 0);
+    }
+
+    void RenderCommandBuffer::BindFramebuffer(Framebuffer* target, const glm::vec4& clearColor)
+    {
+        auto* command = static_cast<FramebufferCommand*>(Allocate(RenderCommandType::BindFramebuffer, sizeof(FramebufferCommand)));
+        command->Target = target;
+        command->ClearColor = clearColor;
+    }
+
+    void RenderCommandBuffer::UnbindFramebuffer(Framebuffer* target)
+    {
+        auto* command = static_cast<FramebufferCommand*>(Allocate(RenderCommandType::UnbindFramebuffer, sizeof(FramebufferCommand)));
+        command->Target = target;
+        command->ClearColor = glm::vec4(0.0f);
+    }
+
+    void RenderCommandBuffer::Present()
+    {
+        Allocate(RenderCommandType::Present, 0);
+    }
+
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "SpriteInstance.h"
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aether {
+
+    class Texture2D;
+    class Framebuffer;
+
+    enum class RenderCommandType : uint32_t
+    {
+        BeginScene = 0,
+        DrawInstances,
+        EndScene,
+        BindFramebuffer,
+        UnbindFramebuffer,
+        Present
+    };
+
+    // Every command starts with a header. Size covers header + payload and keeps
+    // the next command aligned, so a reader only ever advances by Size.
+    struct RenderCommandHeader
+    {
+        RenderCommandType Type;
+        uint32_t Size;
+    };
+
+    struct BeginSceneCommand
+    {
+        glm::mat4 ViewProjection;
+    };
+
+    // Followed in the stream by Count SpriteInstance records
+    struct DrawInstancesCommand
+    {
+        const Texture2D* Texture; // Must outlive the frame (atlas pages, white when null)
+        uint32_t Count;
+
+        const SpriteInstance* GetInstances() const { return reinterpret_cast<const SpriteInstance*>(this + 1); }
+    };
+
+    // BindFramebuffer binds Target and clears its colour (to ClearColor) and depth;
+    // UnbindFramebuffer goes back to the window. ClearColor is unused when unbinding.
+    struct FramebufferCommand
+    {
+        Framebuffer* Target; // Must outlive the frame
+        glm::vec4 ClearColor;
+    };
+
+    // --- Render Command Buffer ---
+    // Linear byte stream produced by render extraction and consumed by a RenderBackend.
+    // Commands are copied in by value (including instance data), so the producer can
+    // mutate the registry as soon as recording ends. Reset() keeps the capacity, so a
+    // buffer reused every frame stops allocating after warm-up.
+    class RenderCommandBuffer
+    {
+    public:
+        static constexpr size_t CommandAlignment = 16;
+
+        void Reset() { m_Size = 0; m_CommandCount = 0; }
+
+        void BeginScene(const glm::mat4& viewProjection);
+        void DrawInstances(const Texture2D* texture, const SpriteInstance* instances, uint32_t count);
+        void EndScene();
+
+        void BindFramebuffer(Framebuffer* target, const glm::vec4& clearColor);
+        void UnbindFramebuffer(Framebuffer* target);
+
+        // Ends the frame: UI overlay, then the buffer swap. Recorded once per frame, last.
+        void Present();
+
+        const uint8_t* GetData() const { return m_Data.data(); }
+        size_t GetSize() const { return m_Size; }
+        size_t GetCapacity() const { return m_Data.size(); }
+        uint32_t GetCommandCount() const { return m_CommandCount; }
+        bool IsEmpty() const { return m_CommandCount == 0; }
+
+        // Calls func(const RenderCommandHeader&, const void* payload) for each command, in order
+        template<typename Func>
+        void ForEach(Func&& func) const
+        {
+            size_t offset = 0;
+            while (offset < m_Size)
+            {
+                const auto* header = reinterpret_cast<const RenderCommandHeader*>(m_Data.data() + offset);
+                func(*header, m_Data.data() + offset + sizeof(RenderCommandHeader));
+                offset += header->Size;
+            }
+        }
+
+    private:
+        // Reserves header + payloadSize bytes; the pointer is valid until the next Allocate
+        void* Allocate(RenderCommandType type, size_t payloadSize);
+
+    private:
+        std::vector<uint8_t> m_Data;
+        size_t m_Size = 0;
+        uint32_t m_CommandCount = 0;
+    };
+
+    static_assert(sizeof(RenderCommandHeader) % alignof(DrawInstancesCommand) == 0, "Payloads must start aligned");
+    static_assert(sizeof(DrawInstancesCommand) % alignof(SpriteInstance) == 0, "Instance data must start aligned");
+
+    // One frame's worth of extracted render data, handed from the main thread to the render thread
+    struct FramePacket
+    {
+        RenderCommandBuffer Commands;
+        uint64_t FrameIndex = 0;
+    };
+
+}
@@ -0,0 +1,86 @@
+#include "RenderQueue.h"
+#include <algorithm>
+#include <cstring>
+
+namespace aether {
+
+    namespace SortKey {
+
+        // Maps a float to 24 bits that sort in the same order (sign-flip trick, top bits kept)
+        static uint64_t DepthBits(float depth)
+        {
+            uint32_t bits;
+            std::memcpy(&bits, &depth, sizeof(bits));
+            bits = (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+            return bits >> 8;
+        }
+
+        uint64_t Make(int32_t layer, bool translucent, uint32_t shader, uint32_t texture, float depth)
+        {
+            const uint64_t layerBits = (uint64_t)(std::clamp(layer, -128, 127) + 128);
+            const uint64_t shaderBits = shader & 0xffu;
+            const uint64_t textureBits = texture & 0xffffu;
+            const uint64_t depthBits = DepthBits(depth);
+
+            uint64_t key = (layerBits << 56) | ((uint64_t)translucent << 55);
+            if (translucent)
+                key |= ((~depthBits & 0xffffffu) << 31) | (shaderBits << 23) | (textureBits << 7);
+            else
+                key |= (shaderBits << 47) | (textureBits << 31) | (depthBits << 7);
+            return key;
+        }
+
+        uint64_t GetStateBits(uint64_t key)
+        {
+            const uint64_t opaqueMask = ~((1ull << 31) - 1);
+            const uint64_t translucentMask = (0x1ffull << 55) | (0xffffffull << 7);
+            return key & (IsTranslucent(key) ? translucentMask : opaqueMask);
+        }
+    }
+
+    void RenderQueue::Sort()
+    {
+        const size_t count = m_Entries.size();
+        if (count < 2) return;
+
+        m_Scratch.resize(count);
+        Entry* src = m_Entries.data();
+        Entry* dst = m_Scratch.data();
+
+        // All eight histograms in one read of the keys
+        uint32_t histograms[8][256] = {};
+        for (size_t i = 0; i < count; i++)
+        {
+            uint64_t key = src[i].Key;
+            for (int pass = 0; pass < 8; pass++)
+                histograms[pass][(key >> (pass * 8)) & 0xff]++;
+        }
+
+        for (int pass = 0; pass < 8; pass++)
+        {
+            uint32_t* histogram = histograms[pass];
+            const int shift = pass * 8;
+
+            // Every key has the same byte here: the pass would be an identity permutation
+            if (histogram[(src[0].Key >> shift) & 0xff] == count)
+                continue;
+
+            uint32_t offset = 0;
+            for (int b = 0; b < 256; b++)
+            {
+                uint32_t n = histogram[b];
+                histogram[b] = offset;
+                offset += n;
+            }
+
+            for (size_t i = 0; i < count; i++)
+                dst[histogram[(src[i].Key >> shift) & 0xff]++] = src[i];
+
+            std::swap(src, dst);
+        }
+
+        if (src != m_Entries.data())
+            m_Entries.swap(m_Scratch);
+    }
+
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aether {
+
+    // --- Sort Key ---
+    // 64-bit key; sorting ascending gives the draw order.
+    //
+    //   63..56  layer        (signed, biased: lower layers draw first)
+    //   55      translucent  (opaque first, then blended on top)
+    //   opaque:      54..47 shader | 46..31 texture | 30..7 depth (front to back)
+    //   translucent: 54..31 depth (back to front) | 30..23 shader | 22..7 texture
+    //   6..0    unused
+    //
+    // Opaque draws group by state to make batches as long as possible; translucent
+    // draws must respect depth first and only batch where neighbours share state.
+    // The opaque layout is only correct when the depth test resolves overlap: with
+    // depth testing off (Renderer2D), submit everything as translucent.
+    namespace SortKey {
+
+        // depth: larger = further from the viewer
+        uint64_t Make(int32_t layer, bool translucent, uint32_t shader, uint32_t texture, float depth);
+
+        inline uint32_t GetLayerBits(uint64_t key) { return (uint32_t)(key >> 56); }
+        inline bool IsTranslucent(uint64_t key) { return (key >> 55) & 1; }
+
+        // Layer + translucency + shader + texture: draws sharing this can share a batch
+        uint64_t GetStateBits(uint64_t key);
+    }
+
+    // --- Render Queue ---
+    // Collects (key, payload) pairs for a frame and sorts them once with an LSD radix
+    // sort (8 passes of 8 bits, skipping passes where every key has the same byte).
+    // The sort is stable, so equal keys keep submission order. Payload is an index
+    // into the caller's own per-frame draw data.
+    class RenderQueue
+    {
+    public:
+        struct Entry
+        {
+            uint64_t Key;
+            uint32_t Payload;
+        };
+
+        void Clear() { m_Entries.clear(); }
+        void Reserve(size_t count) { m_Entries.reserve(count); m_Scratch.reserve(count); }
+
+        void Submit(uint64_t key, uint32_t payload) { m_Entries.push_back({ key, payload }); }
+
+        void Sort();
+
+        const std::vector<Entry>& GetEntries() const { return m_Entries; }
+        size_t Size() const { return m_Entries.size(); }
+        bool Empty() const { return m_Entries.empty(); }
+
+        std::vector<Entry>::const_iterator begin() const { return m_Entries.begin(); }
+        std::vector<Entry>::const_iterator end() const { return m_Entries.end(); }
+
+    private:
+        std::vector<Entry> m_Entries;
+        std::vector<Entry> m_Scratch; // Ping-pong buffer for the radix passes
+    };
+
+}
@@ -0,0 +1,121 @@
+#include "RenderThread.h"
+#include "../core/AetherTime.h"
+#include "../core/Log.h"
+
+namespace aether {
+
+    RenderThread::RenderThread(std::unique_ptr<RenderBackend> backend, RenderThreadMode mode)
+        : m_Backend(std::move(backend)), m_Mode(mode)
+    {
+        AETHER_ASSERT(m_Backend, "RenderThread needs a backend");
+
+        if (m_Mode == RenderThreadMode::Threaded)
+            m_Thread = std::thread(&RenderThread::ThreadLoop, this);
+    }
+
+    RenderThread::~RenderThread()
+    {
+        if (!m_Thread.joinable()) return;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            WaitForIdle(lock);
+            m_Quit = true;
+        }
+        m_WorkReady.notify_one();
+        m_Thread.join();
+
+        // Shutdown releases GPU resources on the producer thread
+        if (!m_ProducerHasContext)
+            m_Backend->MakeContextCurrent();
+    }
+
+    void RenderThread::Submit()
+    {
+        FramePacket& packet = m_Packets[m_WriteIndex];
+        packet.FrameIndex = m_SubmittedFrames++;
+
+        if (m_Mode == RenderThreadMode::Inline)
+        {
+            m_Backend->Execute(packet.Commands);
+            packet.Commands.Reset();
+            return;
+        }
+
+        {
+            // The other packet is the one the render thread may still be executing
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            double waitStart = AetherTime::Now();
+            WaitForIdle(lock);
+            m_LastWaitMs = m_FrameWaitMs + (AetherTime::Now() - waitStart) * 1000.0;
+            m_FrameWaitMs = 0.0;
+
+            if (m_ProducerHasContext)
+            {
+                m_Backend->ReleaseContext();
+                m_ProducerHasContext = false;
+            }
+            m_Pending = &packet;
+        }
+        m_WorkReady.notify_one();
+
+        // Only the producer touches m_WriteIndex. The packet it now points at was
+        // executed before WaitForIdle returned, so it is safe to record into.
+        m_WriteIndex ^= 1;
+        m_Packets[m_WriteIndex].Commands.Reset();
+    }
+
+    void RenderThread::Flush()
+    {
+        if (m_Mode == RenderThreadMode::Inline) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        WaitForIdle(lock);
+    }
+
+    void RenderThread::ReclaimContext()
+    {
+        if (m_Mode == RenderThreadMode::Inline || m_ProducerHasContext) return;
+
+        {
+            // The render thread released the context before clearing m_Pending
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            double waitStart = AetherTime::Now();
+            WaitForIdle(lock);
+            m_FrameWaitMs += (AetherTime::Now() - waitStart) * 1000.0;
+        }
+
+        m_Backend->MakeContextCurrent();
+        m_ProducerHasContext = true;
+    }
+
+    void RenderThread::WaitForIdle(std::unique_lock<std::mutex>& lock)
+    {
+        m_WorkDone.wait(lock, [this] { return m_Pending == nullptr; });
+    }
+
+    void RenderThread::ThreadLoop()
+    {
+        while (true)
+        {
+            FramePacket* packet = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_Mutex);
+                m_WorkReady.wait(lock, [this] { return m_Pending != nullptr || m_Quit; });
+                if (m_Quit) return;
+                packet = m_Pending;
+            }
+
+            m_Backend->MakeContextCurrent();
+            m_Backend->Execute(packet->Commands);
+            m_Backend->ReleaseContext();
+
+            {
+                std::lock_guard<std::mutex> lock(m_Mutex);
+                m_Pending = nullptr;
+            }
+            m_WorkDone.notify_all();
+        }
+    }
+
+}
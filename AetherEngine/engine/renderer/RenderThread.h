@@ -0,0 +1,79 @@
+#pragma once
+
+#include "RenderCommandBuffer.h"
+#include "RenderBackend.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <cstdint>
+
+namespace aether {
+
+    enum class RenderThreadMode
+    {
+        Inline = 0, // Submit() executes on the calling thread
+        Threaded    // A dedicated thread executes packets, one frame behind the producer
+    };
+
+    // --- Render Thread ---
+    // Double-buffered hand-off between render extraction and a RenderBackend.
+    // The producer records into GetWritePacket() and calls Submit(). In Threaded
+    // mode Submit() waits only for the frame before it, then returns while the
+    // backend works, so frame N+1 is simulated while frame N is submitted.
+    //
+    // The GPU context is current on one thread at a time. The producer holds it
+    // from construction; Submit() hands it to the render thread, which binds it
+    // around each packet, and ReclaimContext() takes it back for producer-side
+    // GPU work (event-driven resizes, resource uploads, ImGui platform windows).
+    class RenderThread
+    {
+    public:
+        RenderThread(std::unique_ptr<RenderBackend> backend, RenderThreadMode mode = RenderThreadMode::Inline);
+        ~RenderThread();
+
+        RenderThread(const RenderThread&) = delete;
+        RenderThread& operator=(const RenderThread&) = delete;
+
+        // Cleared and ready to record; owned by the producer until Submit()
+        FramePacket& GetWritePacket() { return m_Packets[m_WriteIndex]; }
+        void Submit();
+
+        // Blocks until every submitted packet has executed
+        void Flush();
+
+        // Flushes, then makes the context current on the calling (producer) thread
+        // until the next Submit(). No-op in Inline mode or if already held.
+        void ReclaimContext();
+
+        RenderThreadMode GetMode() const { return m_Mode; }
+        RenderBackend& GetBackend() { return *m_Backend; }
+
+        uint64_t GetSubmittedFrames() const { return m_SubmittedFrames; }
+        // Time the producer spent blocked on the previous frame (Submit + ReclaimContext)
+        double GetLastWaitMs() const { return m_LastWaitMs; }
+
+    private:
+        void ThreadLoop();
+        void WaitForIdle(std::unique_lock<std::mutex>& lock);
+
+    private:
+        std::unique_ptr<RenderBackend> m_Backend;
+        RenderThreadMode m_Mode;
+
+        FramePacket m_Packets[2];
+        uint32_t m_WriteIndex = 0;
+        uint64_t m_SubmittedFrames = 0;
+        double m_LastWaitMs = 0.0;
+        double m_FrameWaitMs = 0.0; // Reclaim waits since the last Submit
+        bool m_ProducerHasContext = true; // Producer thread only
+
+        std::thread m_Thread;
+        std::mutex m_Mutex;
+        std::condition_variable m_WorkReady;
+        std::condition_variable m_WorkDone;
+        FramePacket* m_Pending = nullptr; // Set by Submit, cleared by the render thread when done
+        bool m_Quit = false;
+    };
+
+}
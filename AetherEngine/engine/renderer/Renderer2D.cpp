@@ -1,18 +1,42 @@
 #include "Renderer2D.h"
 #include "VertexArray.h"
 #include "Shader.h"
+#include "Texture.h"
+#include "QuadBatch.h"
+#include "UniformBuffer.h"
+#include "StreamingBuffer.h"
+#include "GLStateCache.h"
 #include "../core/Log.h"
 
 #include <glad/glad.h> 
 #include <glm/glm.hpp>
-#include <glm/gtc/matrix_transform.hpp> 
+#include <algorithm>
 
 namespace aether {
 
     struct Renderer2DStorage
     {
         std::shared_ptr<VertexArray> QuadVertexArray;
-        std::shared_ptr<Shader> FlatColorShader;
+        std::shared_ptr<StreamingBuffer> QuadVertexBuffer;
+        std::shared_ptr<Shader> QuadShader;
+
+        // Instanced sprites: static unit quad + streamed per-instance buffer
+        static constexpr uint32_t MaxInstances = 65536;
+        std::shared_ptr<VertexArray> SpriteVertexArray;
+        std::shared_ptr<StreamingBuffer> SpriteInstanceBuffer;
+        std::shared_ptr<Shader> SpriteShader;
+        std::shared_ptr<Texture2D> WhiteTexture;
+
+        // Matches the std140 "Camera" block in the engine shaders
+        struct CameraData
+        {
+            glm::mat4 ViewProjection;
+        };
+        std::unique_ptr<UniformBuffer> CameraBuffer;
+
+        QuadBatch Batch;
+        uint32_t PremultipliedSlots = 0; // Bit per batch texture slot whose texture stores rgb * a
+        Renderer2D::Statistics Stats;
     };
 
     static Renderer2DStorage* s_Data = nullptr;
@@ -22,33 +46,71 @@ namespace aether {
         AETHER_CORE_INFO("Renderer2D: Initializing...");
         s_Data = new Renderer2DStorage();
 
+        const uint32_t maxQuads = s_Data->Batch.GetMaxQuads();
+
         // Phase 1: Vertex Array
         s_Data->QuadVertexArray = std::make_shared<VertexArray>();
 
-        // Phase 2: Vertex Buffer
-        float squareVertices[4 * 3] = {
-            -0.5f, -0.5f, 0.0f,
-             0.5f, -0.5f, 0.0f,
-             0.5f,  0.5f, 0.0f,
-            -0.5f,  0.5f, 0.0f
+        // Phase 2: Streaming Vertex Buffer (one full batch per ring region; each flush
+        // writes at the next offset and draws with a base vertex)
+        s_Data->QuadVertexBuffer = std::make_shared<StreamingBuffer>(maxQuads * 4 * (uint32_t)sizeof(QuadVertex));
+        s_Data->QuadVertexBuffer->SetLayout({
+            { ShaderDataType::Float3, "a_Position" },
+            { ShaderDataType::Float4, "a_Color" },
+            { ShaderDataType::Float2, "a_TexCoord" },
+            { ShaderDataType::Float,  "a_TexIndex" }
+        });
+        s_Data->QuadVertexArray->AddVertexBuffer(s_Data->QuadVertexBuffer);
+
+        // Phase 3: Static Index Buffer (every batch uses a prefix of it)
+        std::vector<uint32_t> quadIndices = QuadBatch::GenerateIndices(maxQuads);
+        auto quadIB = std::make_shared<IndexBuffer>(quadIndices.data(), (uint32_t)quadIndices.size());
+        s_Data->QuadVertexArray->SetIndexBuffer(quadIB);
+
+        // Phase 3b: Instanced sprite geometry. Shares the static index buffer (first 6 indices).
+        s_Data->SpriteVertexArray = std::make_shared<VertexArray>();
+
+        float unitQuad[4 * 2] = {
+            -0.5f, -0.5f,
+             0.5f, -0.5f,
+             0.5f,  0.5f,
+            -0.5f,  0.5f
+        };
+        auto unitQuadVB = std::make_shared<VertexBuffer>(unitQuad, (uint32_t)sizeof(unitQuad));
+        unitQuadVB->SetLayout({ { ShaderDataType::Float2, "a_Position" } });
+        s_Data->SpriteVertexArray->AddVertexBuffer(unitQuadVB);
+
+        s_Data->SpriteInstanceBuffer = std::make_shared<StreamingBuffer>(Renderer2DStorage::MaxInstances * (uint32_t)sizeof(SpriteInstance));
+        BufferLayout instanceLayout = {
+            { ShaderDataType::Float2, "i_Position" },
+            { ShaderDataType::Float2, "i_Scale" },
+            { ShaderDataType::Float,  "i_Rotation" },
+            { ShaderDataType::Float4, "i_Color" },
+            { ShaderDataType::Float4, "i_UV" }
         };
+        instanceLayout.SetDivisor(1);
+        s_Data->SpriteInstanceBuffer->SetLayout(instanceLayout);
+        s_Data->SpriteVertexArray->AddVertexBuffer(s_Data->SpriteInstanceBuffer);
+        s_Data->SpriteVertexArray->SetIndexBuffer(quadIB);
+
+        // Phase 4: White texture for untextured quads (slot 0)
+        TextureSpecification whiteSpec;
+        whiteSpec.GenerateMips = false;
+        s_Data->WhiteTexture = std::make_shared<Texture2D>(whiteSpec);
+        uint32_t whitePixel = 0xffffffff;
+        s_Data->WhiteTexture->SetData(&whitePixel, sizeof(uint32_t));
 
-        auto squareVB = std::make_shared<VertexBuffer>(squareVertices, static_cast<uint32_t>(sizeof(squareVertices)));
-        squareVB->SetLayout({ { ShaderDataType::Float3, "a_Position" } });
-        s_Data->QuadVertexArray->AddVertexBuffer(squareVB);
+        // Phase 5: Camera uniform buffer, shared by every shader at binding 0
+        s_Data->CameraBuffer = std::make_unique<UniformBuffer>((uint32_t)sizeof(Renderer2DStorage::CameraData), UniformBinding::Camera);
 
-        // Phase 3: Index Buffer
-        uint32_t squareIndices[6] = { 0, 1, 2, 2, 3, 0 };
-        auto squareIB = std::make_shared<IndexBuffer>(squareIndices, 6);
-        s_Data->QuadVertexArray->SetIndexBuffer(squareIB);
+        // Phase 6: Shader (Load from /engine/ mount point)
+        AETHER_CORE_INFO("Renderer2D: Loading Quad Shader...");
+        s_Data->QuadShader = std::make_shared<Shader>("/engine/shaders/Renderer2D_Quad.glsl", "/engine/shaders/Renderer2D_Quad.glsl");
+        AETHER_ASSERT(s_Data->QuadShader, "Renderer2D: Shader failed to initialize!");
 
-        // Phase 4: Shader (Load from /engine/ mount point)
-        // We moved the shader to EngineContent/shaders/FlatColor.glsl, which is mounted to /engine
-        AETHER_CORE_INFO("Renderer2D: Loading FlatColor Shader...");
-        s_Data->FlatColorShader = std::make_shared<Shader>("/engine/shaders/FlatColor.glsl", "/engine/shaders/FlatColor.glsl");
+        s_Data->SpriteShader = std::make_shared<Shader>("/engine/shaders/Renderer2D_Sprite.glsl", "/engine/shaders/Renderer2D_Sprite.glsl");
 
-        AETHER_ASSERT(s_Data->FlatColorShader, "Renderer2D: Shader failed to initialize!");
-        AETHER_CORE_INFO("Renderer2D: Initialized Successfully.");
+        AETHER_CORE_INFO("Renderer2D: Initialized Successfully (batch size: {0} quads).", maxQuads);
     }
 
     void Renderer2D::Shutdown() {
@@ -58,29 +120,144 @@ namespace aether {
 
     void Renderer2D::BeginScene(const glm::mat4& viewProjection) {
         if (!s_Data) return;
-        s_Data->FlatColorShader->Bind();
-        s_Data->FlatColorShader->SetMat4("u_ViewProjection", &viewProjection[0][0]);
+        Renderer2DStorage::CameraData camera{ viewProjection };
+        s_Data->CameraBuffer->SetData(&camera, sizeof(camera));
+
+        // Translucent sprites are drawn back to front by the render queue. Set every
+        // scene: other code (ImGui) changes it, and the cache elides it when unchanged.
+        // The shaders output premultiplied colour (straight-alpha textures are converted
+        // as they are sampled), so cooked premultiplied textures blend correctly too.
+        GLStateCache::SetBlend(true);
+        GLStateCache::SetBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        GLStateCache::SetDepthTest(false);
+
+        s_Data->Batch.Reset(s_Data->WhiteTexture->GetRendererID());
+        s_Data->PremultipliedSlots = 0;
+
+        s_Data->QuadVertexBuffer->BeginFrame();
+        s_Data->SpriteInstanceBuffer->BeginFrame();
+    }
+
+    void Renderer2D::EndScene() {
+        if (!s_Data) return;
+        Flush();
+
+        // Fence the regions this scene's draws read from
+        s_Data->QuadVertexBuffer->EndFrame();
+        s_Data->SpriteInstanceBuffer->EndFrame();
     }
 
-    void Renderer2D::EndScene() {}
+    void Renderer2D::Flush() {
+        QuadBatch& batch = s_Data->Batch;
+        if (batch.IsEmpty()) return;
+
+        uint32_t offset = s_Data->QuadVertexBuffer->Write(batch.GetVertices(), batch.GetVertexDataSize(), (uint32_t)sizeof(QuadVertex));
+        if (offset == StreamingRing::InvalidOffset)
+        {
+            batch.Reset(s_Data->WhiteTexture->GetRendererID());
+            s_Data->PremultipliedSlots = 0;
+            return;
+        }
+
+        const uint32_t* slots = batch.GetTextureSlots();
+        for (uint32_t i = 0; i < batch.GetTextureSlotCount(); i++)
+            GLStateCache::BindTextureUnit(i, slots[i]);
+
+        s_Data->QuadShader->Bind();
+        s_Data->QuadShader->SetInt("u_PremultipliedSlots", (int)s_Data->PremultipliedSlots);
+        s_Data->QuadVertexArray->Bind();
+        glDrawElementsBaseVertex(GL_TRIANGLES, batch.GetIndexCount(), GL_UNSIGNED_INT, nullptr, offset / (uint32_t)sizeof(QuadVertex));
+
+        s_Data->Stats.DrawCalls++;
+        s_Data->Stats.QuadCount += batch.GetQuadCount();
+
+        batch.Reset(s_Data->WhiteTexture->GetRendererID());
+        s_Data->PremultipliedSlots = 0;
+    }
 
     void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color) {
         if (!s_Data) return;
 
-        s_Data->FlatColorShader->Bind();
-        s_Data->FlatColorShader->SetFloat4("u_Color", color.r, color.g, color.b, color.a);
+        if (s_Data->Batch.IsFull())
+            Flush();
+
+        s_Data->Batch.AddQuad(position, size, color);
+    }
 
-        glm::mat4 transform = glm::translate(glm::mat4(1.0f), glm::vec3(position.x, position.y, 0.0f))
-            * glm::scale(glm::mat4(1.0f), glm::vec3(size.x, size.y, 1.0f));
+    void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture,
+        const glm::vec4& tint, float tiling) {
+        if (!s_Data) return;
 
-        s_Data->FlatColorShader->SetMat4("u_Transform", &transform[0][0]);
+        QuadBatch& batch = s_Data->Batch;
+        if (batch.IsFull())
+            Flush();
 
-        s_Data->QuadVertexArray->Bind();
-        glDrawElements(GL_TRIANGLES, s_Data->QuadVertexArray->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+        int slot = batch.AcquireTextureSlot(texture->GetRendererID());
+        if (slot == QuadBatch::InvalidSlot)
+        {
+            Flush();
+            slot = batch.AcquireTextureSlot(texture->GetRendererID());
+        }
+
+        if (texture->IsPremultiplied())
+            s_Data->PremultipliedSlots |= 1u << slot;
+
+        batch.AddQuad(position, size, tint, slot, tiling);
+    }
+
+    void Renderer2D::DrawInstances(const SpriteInstance* instances, uint32_t count, const Texture2D* texture) {
+        if (!s_Data || count == 0) return;
+
+        // Anything already batched was submitted first and must stay underneath
+        Flush();
+
+        (texture ? texture : s_Data->WhiteTexture.get())->Bind(0);
+        s_Data->SpriteShader->Bind();
+        s_Data->SpriteShader->SetInt("u_Premultiplied", texture && texture->IsPremultiplied());
+        s_Data->SpriteVertexArray->Bind();
+
+        for (uint32_t first = 0; first < count; first += Renderer2DStorage::MaxInstances)
+        {
+            uint32_t chunk = std::min(count - first, Renderer2DStorage::MaxInstances);
+            uint32_t offset = s_Data->SpriteInstanceBuffer->Write(instances + first, chunk * (uint32_t)sizeof(SpriteInstance), (uint32_t)sizeof(SpriteInstance));
+            if (offset == StreamingRing::InvalidOffset) break;
+
+            glDrawElementsInstancedBaseInstance(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, chunk, offset / (uint32_t)sizeof(SpriteInstance));
+
+            s_Data->Stats.DrawCalls++;
+            s_Data->Stats.QuadCount += chunk;
+            s_Data->Stats.InstanceCount += chunk;
+        }
     }
 
     void Renderer2D::OnWindowResize(uint32_t width, uint32_t height)
     {
         glViewport(0, 0, width, height);
     }
-}
\ No newline at end of file
+
+    const Renderer2D::Statistics& Renderer2D::GetStats()
+    {
+        static const Statistics s_Empty;
+        if (!s_Data) return s_Empty;
+
+        Statistics& stats = s_Data->Stats;
+        stats.StreamStalls = 0;
+        stats.StreamOverflows = 0;
+        stats.StreamWaitMs = 0.0f;
+        for (const StreamingBuffer* buffer : { s_Data->QuadVertexBuffer.get(), s_Data->SpriteInstanceBuffer.get() })
+        {
+            stats.StreamStalls += buffer->GetStats().Stalls;
+            stats.StreamOverflows += buffer->GetStats().Overflows;
+            stats.StreamWaitMs += (float)buffer->GetStats().WaitMs;
+        }
+        return stats;
+    }
+
+    void Renderer2D::ResetStats()
+    {
+        if (!s_Data) return;
+        s_Data->Stats = {};
+        s_Data->QuadVertexBuffer->ResetStats();
+        s_Data->SpriteInstanceBuffer->ResetStats();
+    }
+}
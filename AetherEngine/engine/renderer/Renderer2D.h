@@ -1,10 +1,14 @@
 #pragma once
 
 #include <glm/glm.hpp> // Vector and Matrix types
+#include <memory>
 #include "Shader.h" // Our Shader Class
+#include "SpriteInstance.h"
 
 namespace aether {
 
+    class Texture2D;
+
     class Renderer2D
     {
     public:
@@ -14,13 +18,43 @@ namespace aether {
         static void BeginScene(const glm::mat4& viewProjection);
         static void EndScene();
 
+        // Submits the current batch (called automatically when it fills up)
+        static void Flush();
+
         // The Command: Draw a flat colored rectangle
-        // position: where is it?
+        // position: where is it? (centre)
         // size: how big is it?
         // color: what color is it? (R, G, B, A)
         static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
+        static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const std::shared_ptr<Texture2D>& texture,
+            const glm::vec4& tint = glm::vec4(1.0f), float tiling = 1.0f);
+
+        // Instanced path for large homogeneous sprite sets: one unit quad, one
+        // per-instance record each, all sampling one texture (an atlas page, or
+        // white when null). Flushes the quad batch first to keep draw order.
+        static void DrawInstances(const SpriteInstance* instances, uint32_t count, const Texture2D* texture = nullptr);
 
         static void OnWindowResize(uint32_t width, uint32_t height);
+
+        // --- Statistics ---
+        // Accumulate until ResetStats(); the editor resets them once per frame
+        struct Statistics
+        {
+            uint32_t DrawCalls = 0;
+            uint32_t QuadCount = 0;      // Includes instanced sprites
+            uint32_t InstanceCount = 0;  // Sprites drawn through DrawInstances
+
+            // Streaming vertex buffers: waits on a region the GPU had not finished reading
+            uint32_t StreamStalls = 0;
+            uint32_t StreamOverflows = 0;
+            float StreamWaitMs = 0.0f;
+
+            uint32_t GetVertexCount() const { return QuadCount * 4; }
+            uint32_t GetIndexCount() const { return QuadCount * 6; }
+        };
+
+        static const Statistics& GetStats();
+        static void ResetStats();
     };
 
-}
\ No newline at end of file
+}
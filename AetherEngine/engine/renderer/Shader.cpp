@@ -1,19 +1,100 @@
 #include "Shader.h"
+#include "GLStateCache.h"
+#include "ShaderCache.h"
+#include "ShaderReloader.h"
 #include "../core/Log.h"
 #include "../core/VFS.h"
 #include <sstream>
 #include <vector>
+#include <algorithm>
 
 namespace aether {
 
+    // Binaries are only valid for the exact driver that produced them
+    static const std::string& GetDriverString()
+    {
+        static const std::string driver = [] {
+            auto get = [](GLenum name) {
+                const GLubyte* value = glGetString(name);
+                return value ? std::string((const char*)value) : std::string();
+            };
+            return get(GL_VENDOR) + "|" + get(GL_RENDERER) + "|" + get(GL_VERSION);
+        }();
+        return driver;
+    }
+
+    static bool SupportsProgramBinaries()
+    {
+        static const bool supported = [] {
+            GLint formats = 0;
+            glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+            return formats > 0;
+        }();
+        return supported;
+    }
+
     Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath)
     {
         // 1. Read source via VFS
         std::string source = VFS::ReadText(vertexPath);
         AETHER_ASSERT(!source.empty(), "Shader source is empty or file not found: {0}", vertexPath);
 
-        // 2. Parse the single file into multiple shader sources
-        // This is a robust line-by-line state machine
+        // 2. Split the single file into per-stage sources
+        std::string vSource, fSource;
+        bool parsed = Preprocess(source, vSource, fSource);
+        AETHER_ASSERT(parsed, "Shader needs one vertex and one fragment #type section: {0}", vertexPath);
+
+        ShaderReloader::Register(this, vertexPath);
+
+        // 3. Try the binary cache
+        const uint64_t cacheKey = ComputeCacheKey(source);
+
+        m_RendererID = glCreateProgram();
+        if (LoadProgramBinary(cacheKey))
+        {
+            CacheUniformLocations();
+            AETHER_CORE_INFO("Shader Loaded From Cache: {0}", vertexPath);
+            return;
+        }
+
+        // 4. Compile Shaders
+        GLuint vertex = CompileStage(GL_VERTEX_SHADER, vSource);
+        CheckCompileErrors(vertex, "VERTEX");
+
+        GLuint fragment = CompileStage(GL_FRAGMENT_SHADER, fSource);
+        CheckCompileErrors(fragment, "FRAGMENT");
+
+        // 5. Link Program
+        glProgramParameteri(m_RendererID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glAttachShader(m_RendererID, vertex);
+        glAttachShader(m_RendererID, fragment);
+        glLinkProgram(m_RendererID);
+        CheckCompileErrors(m_RendererID, "PROGRAM");
+
+        // Production Guard: If linking failed, we must know immediately
+        AETHER_ASSERT(m_RendererID != 0, "Shader program linking failed for {0}", vertexPath);
+
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+
+        if (ShaderCache::IsEnabled() && SupportsProgramBinaries())
+            StoreProgramBinary(m_RendererID, cacheKey);
+
+        CacheUniformLocations();
+
+        AETHER_CORE_INFO("Shader Compiled Successfully: {0}", vertexPath);
+    }
+
+    Shader::~Shader()
+    {
+        ShaderReloader::Unregister(this);
+        GLStateCache::OnProgramDeleted(m_RendererID);
+        glDeleteProgram(m_RendererID);
+    }
+
+    bool Shader::Preprocess(const std::string& source, std::string& vertexSource, std::string& fragmentSource)
+    {
+        // Line-by-line state machine: "#type vertex" / "#type fragment" start a section
         std::stringstream ss(source);
         std::string line;
         std::stringstream shaderSources[2]; // 0: Vertex, 1: Fragment
@@ -27,8 +108,8 @@ namespace aether {
                     mode = 0;
                 else if (line.find("fragment") != std::string::npos)
                     mode = 1;
-
-                AETHER_ASSERT(mode != -1, "Invalid shader type specified in: {0}", vertexPath);
+                else
+                    return false; // Unknown stage
             }
             else if (mode != -1)
             {
@@ -36,57 +117,91 @@ namespace aether {
             }
         }
 
-        std::string vSource = shaderSources[0].str();
-        std::string fSource = shaderSources[1].str();
-
-        AETHER_ASSERT(!vSource.empty(), "Vertex shader source is missing in {0}", vertexPath);
-        AETHER_ASSERT(!fSource.empty(), "Fragment shader source is missing in {0}", vertexPath);
-
-        const char* vShaderCode = vSource.c_str();
-        const char* fShaderCode = fSource.c_str();
+        vertexSource = shaderSources[0].str();
+        fragmentSource = shaderSources[1].str();
+        return !vertexSource.empty() && !fragmentSource.empty();
+    }
 
-        // 3. Compile Shaders
-        uint32_t vertex, fragment;
+    uint64_t Shader::ComputeCacheKey(const std::string& source)
+    {
+        // Shaders have no defines yet, hence the empty string
+        return ShaderCache::ComputeKey(source, "", GetDriverString());
+    }
 
-        vertex = glCreateShader(GL_VERTEX_SHADER);
-        glShaderSource(vertex, 1, &vShaderCode, NULL);
-        glCompileShader(vertex);
-        CheckCompileErrors(vertex, "VERTEX");
+    GLuint Shader::CompileStage(GLenum type, const std::string& source)
+    {
+        const char* code = source.c_str();
+        GLuint shader = glCreateShader(type);
+        glShaderSource(shader, 1, &code, NULL);
+        glCompileShader(shader);
+        return shader;
+    }
 
-        fragment = glCreateShader(GL_FRAGMENT_SHADER);
-        glShaderSource(fragment, 1, &fShaderCode, NULL);
-        glCompileShader(fragment);
-        CheckCompileErrors(fragment, "FRAGMENT");
+    void Shader::ReplaceProgram(GLuint program, uint64_t cacheKey)
+    {
+        if (ShaderCache::IsEnabled() && SupportsProgramBinaries())
+            StoreProgramBinary(program, cacheKey);
 
-        // 4. Link Program
-        m_RendererID = glCreateProgram();
-        glAttachShader(m_RendererID, vertex);
-        glAttachShader(m_RendererID, fragment);
-        glLinkProgram(m_RendererID);
-        CheckCompileErrors(m_RendererID, "PROGRAM");
+        GLStateCache::OnProgramDeleted(m_RendererID);
+        glDeleteProgram(m_RendererID);
 
-        // Production Guard: If linking failed, we must know immediately
-        AETHER_ASSERT(m_RendererID != 0, "Shader program linking failed for {0}", vertexPath);
+        m_RendererID = program;
+        CacheUniformLocations();
+    }
 
-        glDeleteShader(vertex);
-        glDeleteShader(fragment);
+    void Shader::Bind() const
+    {
+        GLStateCache::UseProgram(m_RendererID);
+    }
 
-        AETHER_CORE_INFO("Shader Compiled Successfully: {0}", vertexPath);
+    void Shader::Unbind() const
+    {
+        GLStateCache::UseProgram(0);
     }
 
-    Shader::~Shader()
+    bool Shader::LoadProgramBinary(uint64_t cacheKey)
     {
+        if (!SupportsProgramBinaries())
+            return false;
+
+        uint32_t binaryFormat = 0;
+        std::vector<uint8_t> binary;
+        if (!ShaderCache::Load(cacheKey, binaryFormat, binary))
+            return false;
+
+        glProgramBinary(m_RendererID, binaryFormat, binary.data(), (GLsizei)binary.size());
+
+        GLint success = 0;
+        glGetProgramiv(m_RendererID, GL_LINK_STATUS, &success);
+        if (success)
+            return true;
+
+        // The driver may still reject a binary whose key matched; recompile and overwrite it
+        AETHER_CORE_WARN("ShaderCache: driver rejected cached binary {0}, recompiling", ShaderCache::GetEntryPath(cacheKey).filename().string());
+        GLStateCache::OnProgramDeleted(m_RendererID);
         glDeleteProgram(m_RendererID);
+        m_RendererID = glCreateProgram();
+        return false;
     }
 
-    void Shader::Bind() const
+    void Shader::StoreProgramBinary(GLuint program, uint64_t cacheKey)
     {
-        glUseProgram(m_RendererID);
+        GLint length = 0;
+        glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+        if (length <= 0)
+            return;
+
+        std::vector<uint8_t> binary(length);
+        GLenum binaryFormat = 0;
+        glGetProgramBinary(program, length, &length, &binaryFormat, binary.data());
+
+        if (ShaderCache::Store(cacheKey, binaryFormat, binary.data(), (size_t)length))
+            AETHER_CORE_TRACE("ShaderCache: stored program {0} ({1} bytes)", program, length);
     }
 
-    void Shader::Unbind() const
+    void Shader::SetBinaryCacheDirectory(const std::filesystem::path& directory)
     {
-        glUseProgram(0);
+        ShaderCache::SetDirectory(directory);
     }
 
     void Shader::CheckCompileErrors(uint32_t shader, std::string type)
@@ -115,15 +230,60 @@ namespace aether {
         }
     }
 
-    void Shader::SetMat4(const std::string& name, const void* value)
+    void Shader::CacheUniformLocations()
+    {
+        m_UniformLocations.clear();
+
+        GLint count = 0, maxLength = 0;
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &count);
+        glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+        std::vector<char> nameBuffer(std::max(maxLength, 1));
+        for (GLint i = 0; i < count; i++)
+        {
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(m_RendererID, (GLuint)i, (GLsizei)nameBuffer.size(), &length, &size, &type, nameBuffer.data());
+
+            std::string_view name(nameBuffer.data(), length);
+            int location = glGetUniformLocation(m_RendererID, nameBuffer.data());
+            if (location < 0)
+                continue; // Member of a uniform block (e.g. the Camera UBO)
+
+            m_UniformLocations[HashUniformName(name)] = location;
+
+            // Arrays are reported as "name[0]"; also accept the bare name
+            if (name.size() > 3 && name.substr(name.size() - 3) == "[0]")
+                m_UniformLocations[HashUniformName(name.substr(0, name.size() - 3))] = location;
+        }
+
+        AETHER_CORE_TRACE("Shader {0}: cached {1} uniform locations", m_RendererID, m_UniformLocations.size());
+    }
+
+    int Shader::GetUniformLocation(std::string_view name) const
+    {
+        auto it = m_UniformLocations.find(HashUniformName(name));
+        return it != m_UniformLocations.end() ? it->second : -1;
+    }
+
+    void Shader::SetMat4(std::string_view name, const void* value)
+    {
+        glUniformMatrix4fv(GetUniformLocation(name), 1, GL_FALSE, (const float*)value);
+    }
+
+    void Shader::SetFloat4(std::string_view name, float v0, float v1, float v2, float v3)
+    {
+        glUniform4f(GetUniformLocation(name), v0, v1, v2, v3);
+    }
+
+    void Shader::SetInt(std::string_view name, int value)
     {
-        int location = glGetUniformLocation(m_RendererID, name.c_str());
-        glUniformMatrix4fv(location, 1, GL_FALSE, (const float*)value);
+        glUniform1i(GetUniformLocation(name), value);
     }
 
-    void Shader::SetFloat4(const std::string& name, float v0, float v1, float v2, float v3)
+    void Shader::SetIntArray(std::string_view name, int* values, uint32_t count)
     {
-        int location = glGetUniformLocation(m_RendererID, name.c_str());
-        glUniform4f(location, v0, v1, v2, v3);
+        glUniform1iv(GetUniformLocation(name), count, values);
     }
 }
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
-#pragma once
 
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <cstdint>
+#include <filesystem>
 #include <glad/glad.h>
 
 namespace aether {
@@ -18,17 +21,60 @@ namespace aether {
 
         // Uniforms: Ways to send data (Matrices, Floats) to the GPU
         // We use void* for matrices to avoid forcing a math library dependency just yet.
-        void SetMat4(const std::string& name, const void* value);
-        void SetFloat4(const std::string& name, float v0, float v1, float v2, float v3);
-        void SetInt(const std::string& name, int value);
-        void SetIntArray(const std::string& name, int* values, uint32_t count);
+        // Locations come from the cache built at link time (no driver query per call).
+        void SetMat4(std::string_view name, const void* value);
+        void SetFloat4(std::string_view name, float v0, float v1, float v2, float v3);
+        void SetInt(std::string_view name, int value);
+        void SetIntArray(std::string_view name, int* values, uint32_t count);
+
+        // Cached location, or -1 if the program has no such active uniform
+        int GetUniformLocation(std::string_view name) const;
+
+        // FNV-1a; constexpr so literal names can be hashed at compile time
+        static constexpr uint64_t HashUniformName(std::string_view name)
+        {
+            uint64_t hash = 14695981039346656037ull;
+            for (char c : name)
+            {
+                hash ^= (uint8_t)c;
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // Enables the program binary cache (see ShaderCache). Set it before the first
+        // shader is built; programs linked while it is disabled are never stored.
+        // Empty path disables it.
+        static void SetBinaryCacheDirectory(const std::filesystem::path& directory);
+
+        // Splits a "#type vertex" / "#type fragment" file into its stages. Touches no GL
+        // state, so the hot reloader runs it off the main thread. False if malformed.
+        static bool Preprocess(const std::string& source, std::string& vertexSource, std::string& fragmentSource);
 
     private:
+        friend class ShaderReloader;
+
+        static uint64_t ComputeCacheKey(const std::string& source);
+        static GLuint CompileStage(GLenum type, const std::string& source);
+
+        // Hot reload: adopt a freshly linked program and delete the old one
+        void ReplaceProgram(GLuint program, uint64_t cacheKey);
+
+        // Links m_RendererID from a cached binary; false (program left fresh) on a miss
+        bool LoadProgramBinary(uint64_t cacheKey);
+        static void StoreProgramBinary(GLuint program, uint64_t cacheKey);
+
         // Helper to check for syntax errors in shaders
         void CheckCompileErrors(GLuint shader, std::string type);
 
+        // Reads every active uniform once after linking
+        void CacheUniformLocations();
+
     private:
         GLuint m_RendererID; // The GPU handle for this shader program
+
+        // Hashed name -> location. Arrays are stored under both "name" and "name[0]".
+        std::unordered_map<uint64_t, int> m_UniformLocations;
     };
 
 }
\ No newline at end of file
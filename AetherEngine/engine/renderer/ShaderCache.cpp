@@ -0,0 +1,154 @@
+#include "ShaderCache.h"
+#include "../core/Log.h"
+#include <fstream>
+#include <cstdio>
+
+namespace aether {
+
+    // Only touched from the GL thread, alongside the Shader objects that use it
+    struct ShaderCacheStorage
+    {
+        std::filesystem::path Directory;
+    };
+
+    static ShaderCacheStorage s_Cache;
+
+    static constexpr uint64_t FnvOffset = 14695981039346656037ull;
+    static constexpr uint64_t FnvPrime = 1099511628211ull;
+
+    static uint64_t HashBytes(uint64_t hash, std::string_view bytes)
+    {
+        for (char c : bytes)
+        {
+            hash ^= (uint8_t)c;
+            hash *= FnvPrime;
+        }
+        return hash;
+    }
+
+    uint64_t ShaderCache::ComputeKey(std::string_view source, std::string_view defines, std::string_view driver)
+    {
+        // A zero byte cannot appear in GLSL or a driver string, so it separates the fields
+        const std::string_view separator("\0", 1);
+
+        uint64_t hash = FnvOffset;
+        hash = HashBytes(hash, source);
+        hash = HashBytes(hash, separator);
+        hash = HashBytes(hash, defines);
+        hash = HashBytes(hash, separator);
+        hash = HashBytes(hash, driver);
+        return hash;
+    }
+
+    bool ShaderCache::IsEntryValid(const EntryHeader& header, uint64_t expectedKey, size_t payloadSize)
+    {
+        return header.Magic == Magic
+            && header.Version == Version
+            && header.Key == expectedKey
+            && header.Size != 0
+            && header.Size == payloadSize;
+    }
+
+    void ShaderCache::SetDirectory(const std::filesystem::path& directory)
+    {
+        s_Cache.Directory = directory;
+
+        std::error_code error;
+        if (!directory.empty() && !std::filesystem::exists(directory, error))
+            std::filesystem::create_directories(directory, error);
+
+        if (error)
+        {
+            AETHER_CORE_WARN("ShaderCache: cannot create '{0}' ({1}); caching disabled", directory.string(), error.message());
+            s_Cache.Directory.clear();
+        }
+    }
+
+    const std::filesystem::path& ShaderCache::GetDirectory()
+    {
+        return s_Cache.Directory;
+    }
+
+    bool ShaderCache::IsEnabled()
+    {
+        return !s_Cache.Directory.empty();
+    }
+
+    std::filesystem::path ShaderCache::GetEntryPath(uint64_t key)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+        return s_Cache.Directory / name;
+    }
+
+    bool ShaderCache::Load(uint64_t key, uint32_t& binaryFormat, std::vector<uint8_t>& binary)
+    {
+        if (!IsEnabled())
+            return false;
+
+        const std::filesystem::path path = GetEntryPath(key);
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream)
+            return false;
+
+        const std::streamoff fileSize = stream.tellg();
+        if (fileSize < (std::streamoff)sizeof(EntryHeader))
+            return false;
+
+        EntryHeader header;
+        stream.seekg(0);
+        stream.read(reinterpret_cast<char*>(&header), sizeof(EntryHeader));
+
+        const size_t payloadSize = (size_t)fileSize - sizeof(EntryHeader);
+        if (!stream || !IsEntryValid(header, key, payloadSize))
+        {
+            AETHER_CORE_WARN("ShaderCache: discarding stale entry '{0}'", path.filename().string());
+            return false;
+        }
+
+        binary.resize(header.Size);
+        stream.read(reinterpret_cast<char*>(binary.data()), header.Size);
+        if (!stream)
+            return false;
+
+        binaryFormat = header.BinaryFormat;
+        return true;
+    }
+
+    bool ShaderCache::Store(uint64_t key, uint32_t binaryFormat, const void* binary, size_t size)
+    {
+        if (!IsEnabled() || size == 0 || size > UINT32_MAX)
+            return false;
+
+        EntryHeader header;
+        header.Key = key;
+        header.BinaryFormat = binaryFormat;
+        header.Size = (uint32_t)size;
+
+        // Write beside the entry and rename, so a crash never leaves a half-written binary
+        const std::filesystem::path path = GetEntryPath(key);
+        std::filesystem::path temporary = path;
+        temporary += ".tmp";
+
+        {
+            std::ofstream fout(temporary, std::ios::binary | std::ios::trunc);
+            fout.write(reinterpret_cast<const char*>(&header), sizeof(EntryHeader));
+            fout.write(reinterpret_cast<const char*>(binary), size);
+            if (!fout)
+            {
+                AETHER_CORE_WARN("ShaderCache: failed to write '{0}'", temporary.string());
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temporary, path, error);
+        if (error)
+        {
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
+
+}
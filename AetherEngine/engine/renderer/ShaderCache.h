@@ -0,0 +1,52 @@
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace aether {
+
+    // --- Shader Binary Cache ---
+    // Stores linked program binaries (glGetProgramBinary) on disk so later launches can
+    // skip compilation. Entries are keyed by a hash of shader source, defines and the
+    // driver string, so an edited shader or a driver update simply misses.
+    //
+    // This class never touches GL: Shader does the glGetProgramBinary/glProgramBinary
+    // calls and hands the bytes here. Key and validation logic can run without a GPU.
+    class ShaderCache
+    {
+    public:
+        static constexpr uint32_t Magic = 0x43534541; // "AESC"
+        static constexpr uint32_t Version = 1;
+
+        // On-disk layout: this header, then Size bytes of program binary
+        struct EntryHeader
+        {
+            uint32_t Magic = ShaderCache::Magic;
+            uint32_t Version = ShaderCache::Version;
+            uint64_t Key = 0;
+            uint32_t BinaryFormat = 0;
+            uint32_t Size = 0;
+        };
+
+        // FNV-1a over all three inputs, with separators so ("ab", "c") != ("a", "bc")
+        static uint64_t ComputeKey(std::string_view source, std::string_view defines, std::string_view driver);
+
+        // payloadSize: bytes actually present after the header
+        static bool IsEntryValid(const EntryHeader& header, uint64_t expectedKey, size_t payloadSize);
+
+        // Empty path disables the cache (the default; the engine sets it at startup)
+        static void SetDirectory(const std::filesystem::path& directory);
+        static const std::filesystem::path& GetDirectory();
+        static bool IsEnabled();
+
+        static std::filesystem::path GetEntryPath(uint64_t key);
+
+        // False on a missing, stale or corrupt entry
+        static bool Load(uint64_t key, uint32_t& binaryFormat, std::vector<uint8_t>& binary);
+        static bool Store(uint64_t key, uint32_t binaryFormat, const void* binary, size_t size);
+    };
+
+}
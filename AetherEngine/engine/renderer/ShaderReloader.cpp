@@ -0,0 +1,296 @@
+#include "ShaderReloader.h"
+#include "Shader.h"
+#include "../core/FileWatcher.h"
+#include "../core/VFS.h"
+#include "../core/Log.h"
+#include <glad/glad.h>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+
+// KHR_parallel_shader_compile and its ARB twin share the token; glad is generated without them
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace aether {
+
+    struct WatchedShader
+    {
+        Shader* Owner;
+        std::string VirtualPath;
+        std::filesystem::path PhysicalPath;
+    };
+
+    // Produced on the watcher thread
+    struct ParsedSource
+    {
+        std::string PhysicalPath;
+        std::string Source;
+        std::string VertexSource;
+        std::string FragmentSource;
+    };
+
+    struct PendingProgram
+    {
+        Shader* Owner;
+        GLuint Program;
+        GLuint Vertex;
+        GLuint Fragment;
+        uint64_t CacheKey;
+    };
+
+    struct ShaderReloaderStorage
+    {
+        std::unique_ptr<FileWatcher> Watcher;
+
+        // GL thread only
+        std::vector<WatchedShader> Shaders;
+        std::vector<PendingProgram> Pending;
+        ShaderReloader::Statistics Stats;
+
+        // Watcher thread -> GL thread
+        std::mutex ParsedMutex;
+        std::vector<ParsedSource> Parsed;
+    };
+
+    static ShaderReloaderStorage s_Reloader;
+
+    static bool HasParallelCompile()
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; i++)
+        {
+            const char* name = (const char*)glGetStringi(GL_EXTENSIONS, (GLuint)i);
+            if (name && (std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0 || std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0))
+                return true;
+        }
+        return false;
+    }
+
+    // Watcher thread: the file is read straight from disk (VFS mounts belong to the main thread)
+    static void OnSourceChanged(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << stream.rdbuf();
+
+        ParsedSource parsed;
+        parsed.PhysicalPath = path.string();
+        parsed.Source = buffer.str();
+        if (parsed.Source.empty())
+            return; // Truncated mid-save; the final write triggers another change
+
+        if (!Shader::Preprocess(parsed.Source, parsed.VertexSource, parsed.FragmentSource))
+        {
+            AETHER_CORE_WARN("ShaderReloader: '{0}' needs one vertex and one fragment #type section; keeping the old program", path.string());
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(s_Reloader.ParsedMutex);
+        auto& queue = s_Reloader.Parsed;
+
+        // Only the newest version of a file matters
+        auto it = std::find_if(queue.begin(), queue.end(), [&](const ParsedSource& other) { return other.PhysicalPath == parsed.PhysicalPath; });
+        if (it != queue.end())
+            *it = std::move(parsed);
+        else
+            queue.push_back(std::move(parsed));
+    }
+
+    static void DeletePending(const PendingProgram& pending)
+    {
+        glDeleteShader(pending.Vertex);
+        glDeleteShader(pending.Fragment);
+        if (pending.Program)
+            glDeleteProgram(pending.Program);
+    }
+
+    static void CancelPending(Shader* owner)
+    {
+        auto& pending = s_Reloader.Pending;
+        for (auto it = pending.begin(); it != pending.end();)
+        {
+            if (it->Owner == owner)
+            {
+                DeletePending(*it);
+                it = pending.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+    static bool CheckStatus(GLuint object, bool program, const char* stage, const std::string& path)
+    {
+        GLint success = 0;
+        program ? glGetProgramiv(object, GL_LINK_STATUS, &success) : glGetShaderiv(object, GL_COMPILE_STATUS, &success);
+        if (success)
+            return true;
+
+        char infoLog[1024];
+        program ? glGetProgramInfoLog(object, sizeof(infoLog), NULL, infoLog) : glGetShaderInfoLog(object, sizeof(infoLog), NULL, infoLog);
+        AETHER_CORE_ERROR("ShaderReloader: {0} failed for '{1}':\n{2}", stage, path, infoLog);
+        return false;
+    }
+
+    static const WatchedShader* FindWatched(Shader* owner)
+    {
+        for (const WatchedShader& watched : s_Reloader.Shaders)
+        {
+            if (watched.Owner == owner)
+                return &watched;
+        }
+        return nullptr;
+    }
+
+    void ShaderReloader::Init()
+    {
+        if (s_Reloader.Watcher)
+            return;
+
+        s_Reloader.Stats.ParallelCompile = HasParallelCompile();
+        s_Reloader.Watcher = std::make_unique<FileWatcher>(&OnSourceChanged);
+        for (const WatchedShader& watched : s_Reloader.Shaders)
+            s_Reloader.Watcher->Watch(watched.PhysicalPath);
+
+        AETHER_CORE_INFO("ShaderReloader: watching {0} shader(s), parallel compile {1}",
+            s_Reloader.Shaders.size(), s_Reloader.Stats.ParallelCompile ? "available" : "unavailable (reloads link synchronously)");
+    }
+
+    void ShaderReloader::Shutdown()
+    {
+        s_Reloader.Watcher.reset();
+
+        for (const PendingProgram& pending : s_Reloader.Pending)
+            DeletePending(pending);
+        s_Reloader.Pending.clear();
+
+        std::lock_guard<std::mutex> lock(s_Reloader.ParsedMutex);
+        s_Reloader.Parsed.clear();
+    }
+
+    bool ShaderReloader::IsEnabled()
+    {
+        return s_Reloader.Watcher != nullptr;
+    }
+
+    void ShaderReloader::Register(Shader* shader, const std::string& virtualPath)
+    {
+        std::filesystem::path physicalPath;
+        if (!VFS::Resolve(virtualPath, physicalPath))
+            return;
+
+        physicalPath = std::filesystem::absolute(physicalPath);
+        s_Reloader.Shaders.push_back({ shader, virtualPath, physicalPath });
+        if (s_Reloader.Watcher)
+            s_Reloader.Watcher->Watch(physicalPath);
+    }
+
+    void ShaderReloader::Unregister(Shader* shader)
+    {
+        CancelPending(shader);
+
+        auto& shaders = s_Reloader.Shaders;
+        auto it = std::find_if(shaders.begin(), shaders.end(), [shader](const WatchedShader& watched) { return watched.Owner == shader; });
+        if (it == shaders.end())
+            return;
+
+        std::filesystem::path path = it->PhysicalPath;
+        shaders.erase(it);
+
+        // Other shaders may be built from the same file
+        bool stillUsed = std::any_of(shaders.begin(), shaders.end(), [&](const WatchedShader& watched) { return watched.PhysicalPath == path; });
+        if (!stillUsed && s_Reloader.Watcher)
+            s_Reloader.Watcher->Unwatch(path);
+    }
+
+    void ShaderReloader::Update()
+    {
+        if (!s_Reloader.Watcher)
+            return;
+
+        std::vector<ParsedSource> parsed;
+        {
+            std::lock_guard<std::mutex> lock(s_Reloader.ParsedMutex);
+            parsed.swap(s_Reloader.Parsed);
+        }
+
+        // 1. Kick off compiles; with parallel compile none of these calls wait on the driver
+        for (const ParsedSource& source : parsed)
+        {
+            const uint64_t cacheKey = Shader::ComputeCacheKey(source.Source);
+            for (const WatchedShader& watched : s_Reloader.Shaders)
+            {
+                if (watched.PhysicalPath.string() != source.PhysicalPath)
+                    continue;
+
+                CancelPending(watched.Owner); // An older edit still compiling is now stale
+
+                PendingProgram pending;
+                pending.Owner = watched.Owner;
+                pending.CacheKey = cacheKey;
+                pending.Vertex = Shader::CompileStage(GL_VERTEX_SHADER, source.VertexSource);
+                pending.Fragment = Shader::CompileStage(GL_FRAGMENT_SHADER, source.FragmentSource);
+                pending.Program = glCreateProgram();
+                glProgramParameteri(pending.Program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+                glAttachShader(pending.Program, pending.Vertex);
+                glAttachShader(pending.Program, pending.Fragment);
+                glLinkProgram(pending.Program);
+                s_Reloader.Pending.push_back(pending);
+            }
+        }
+
+        // 2. Swap in whatever finished linking
+        auto& pendingPrograms = s_Reloader.Pending;
+        for (auto it = pendingPrograms.begin(); it != pendingPrograms.end();)
+        {
+            PendingProgram& pending = *it;
+            if (s_Reloader.Stats.ParallelCompile)
+            {
+                GLint done = 0;
+                glGetProgramiv(pending.Program, GL_COMPLETION_STATUS_KHR, &done);
+                if (!done)
+                {
+                    ++it;
+                    continue;
+                }
+            }
+
+            const WatchedShader* watched = FindWatched(pending.Owner);
+            std::string path = watched ? watched->VirtualPath : std::string();
+
+            bool linked = CheckStatus(pending.Vertex, false, "VERTEX compile", path)
+                && CheckStatus(pending.Fragment, false, "FRAGMENT compile", path)
+                && CheckStatus(pending.Program, true, "link", path);
+
+            if (linked)
+            {
+                pending.Owner->ReplaceProgram(pending.Program, pending.CacheKey);
+                pending.Program = 0; // Owned by the shader now
+                s_Reloader.Stats.Reloads++;
+                AETHER_CORE_INFO("ShaderReloader: reloaded '{0}'", path);
+            }
+            else
+            {
+                s_Reloader.Stats.Failures++;
+            }
+
+            DeletePending(pending);
+            it = pendingPrograms.erase(it);
+        }
+
+        s_Reloader.Stats.Compiling = (uint32_t)pendingPrograms.size();
+    }
+
+    const ShaderReloader::Statistics& ShaderReloader::GetStats()
+    {
+        return s_Reloader.Stats;
+    }
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace aether {
+
+    class Shader;
+
+    // --- Shader Hot Reload ---
+    // Watches the source file of every live Shader. A saved file is read and split into
+    // stages on the watcher thread; Update() (GL thread, once per frame) compiles and
+    // links it. With KHR/ARB_parallel_shader_compile the driver compiles in the
+    // background and Update() only polls for completion, so the frame never blocks.
+    // The shader keeps its old program until the new one links, then swaps between
+    // frames. A failed compile is logged and the old program stays.
+    class ShaderReloader
+    {
+    public:
+        // Starts watching; shaders created before Init() are picked up here
+        static void Init();
+        static void Shutdown();
+        static bool IsEnabled();
+
+        // Called by Shader; cheap and safe whether or not the reloader is running
+        static void Register(Shader* shader, const std::string& virtualPath);
+        static void Unregister(Shader* shader);
+
+        static void Update();
+
+        // --- Statistics ---
+        struct Statistics
+        {
+            uint32_t Reloads = 0;
+            uint32_t Failures = 0;
+            uint32_t Compiling = 0; // Programs still linking in the background
+            bool ParallelCompile = false;
+        };
+
+        static const Statistics& GetStats();
+    };
+
+}
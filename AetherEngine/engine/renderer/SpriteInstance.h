@@ -0,0 +1,21 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace aether {
+
+    // Per-instance data for Renderer2D::DrawInstances. Layout must match the
+    // instance attributes in Renderer2D_Sprite.glsl. 52 bytes per sprite, against
+    // 4 x sizeof(QuadVertex) = 160 bytes on the batched quad path.
+    struct SpriteInstance
+    {
+        glm::vec2 Position;
+        glm::vec2 Scale;
+        float Rotation; // Radians
+        glm::vec4 Color;
+        glm::vec4 UV;   // u0, v0, u1, v1 inside the bound texture (atlas page)
+    };
+
+    static_assert(sizeof(SpriteInstance) == 13 * sizeof(float), "SpriteInstance must stay tightly packed");
+
+}
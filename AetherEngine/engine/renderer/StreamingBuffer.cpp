@@ -0,0 +1,81 @@
+#include "StreamingBuffer.h"
+#include "../core/Log.h"
+#include <glad/glad.h>
+#include <cstring>
+
+namespace aether {
+
+    // --- GLFenceBackend ---
+
+    static GLsync ToSync(StreamingFenceBackend::Fence fence) { return reinterpret_cast<GLsync>((uintptr_t)fence); }
+
+    StreamingFenceBackend::Fence GLFenceBackend::Insert()
+    {
+        return (Fence)reinterpret_cast<uintptr_t>(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+    }
+
+    bool GLFenceBackend::IsSignaled(Fence fence)
+    {
+        GLenum result = glClientWaitSync(ToSync(fence), 0, 0);
+        return result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+    }
+
+    void GLFenceBackend::Wait(Fence fence)
+    {
+        // Flush on the first wait so the fence is guaranteed to reach the GPU
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true)
+        {
+            GLenum result = glClientWaitSync(ToSync(fence), flags, 1000000000ull); // 1 s
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) return;
+            if (result == GL_WAIT_FAILED)
+            {
+                AETHER_CORE_ERROR("GLFenceBackend: glClientWaitSync failed");
+                return;
+            }
+            flags = 0;
+        }
+    }
+
+    void GLFenceBackend::Delete(Fence fence)
+    {
+        glDeleteSync(ToSync(fence));
+    }
+
+    // --- StreamingBuffer ---
+
+    StreamingBuffer::StreamingBuffer(uint32_t regionSize, uint32_t regionCount)
+        : m_Ring(regionSize, regionCount, m_Fences)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const uint32_t size = m_Ring.GetBufferSize();
+
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferStorage(m_RendererID, size, nullptr, flags);
+        m_MappedData = static_cast<uint8_t*>(glMapNamedBufferRange(m_RendererID, 0, size, flags));
+        AETHER_ASSERT(m_MappedData, "StreamingBuffer: persistent mapping of buffer {0} failed", m_RendererID);
+
+        AETHER_CORE_TRACE("StreamingBuffer Created: ID {0} ({1} x {2} bytes, persistent)", m_RendererID, regionCount, regionSize);
+    }
+
+    StreamingBuffer::~StreamingBuffer()
+    {
+        AETHER_CORE_TRACE("Deleting StreamingBuffer: ID {0}", m_RendererID);
+        glUnmapNamedBuffer(m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void StreamingBuffer::Bind() const
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+    }
+
+    uint32_t StreamingBuffer::Write(const void* data, uint32_t size, uint32_t alignment)
+    {
+        uint32_t offset = m_Ring.Allocate(size, alignment);
+        if (offset != StreamingRing::InvalidOffset)
+            std::memcpy(m_MappedData + offset, data, size);
+        return offset;
+    }
+
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Buffer.h"
+#include "StreamingRing.h"
+#include <memory>
+
+namespace aether {
+
+    // --- GL Fence Backend ---
+    // glFenceSync / glClientWaitSync behind StreamingFenceBackend
+    class GLFenceBackend : public StreamingFenceBackend
+    {
+    public:
+        virtual Fence Insert() override;
+        virtual bool IsSignaled(Fence fence) override;
+        virtual void Wait(Fence fence) override;
+        virtual void Delete(Fence fence) override;
+    };
+
+    // --- Streaming Buffer ---
+    // Vertex data rewritten every frame (batched quads, sprite instances). Immutable
+    // storage mapped once with MAP_PERSISTENT | MAP_COHERENT: writes are plain
+    // memcpys into the current ring region, so there is no glBufferSubData and no
+    // implicit sync. Draws read from the returned offset (base vertex / base instance).
+    class StreamingBuffer
+    {
+    public:
+        StreamingBuffer(uint32_t regionSize, uint32_t regionCount = StreamingRing::DefaultRegionCount);
+        ~StreamingBuffer();
+
+        StreamingBuffer(const StreamingBuffer&) = delete;
+        StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+
+        void Bind() const;
+
+        const BufferLayout& GetLayout() const { return m_Layout; }
+        void SetLayout(const BufferLayout& layout) { m_Layout = layout; }
+
+        void BeginFrame() { m_Ring.BeginFrame(); }
+        void EndFrame() { m_Ring.EndFrame(); }
+
+        // Copies size bytes into the current region. Returns the byte offset in the
+        // buffer (a multiple of alignment), or StreamingRing::InvalidOffset.
+        uint32_t Write(const void* data, uint32_t size, uint32_t alignment);
+
+        const StreamingRing::Statistics& GetStats() const { return m_Ring.GetStats(); }
+        void ResetStats() { m_Ring.ResetStats(); }
+
+        uint32_t GetRendererID() const { return m_RendererID; }
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint8_t* m_MappedData = nullptr;
+        BufferLayout m_Layout;
+
+        GLFenceBackend m_Fences;
+        StreamingRing m_Ring; // Declared after m_Fences: deletes its fences through it
+    };
+
+}
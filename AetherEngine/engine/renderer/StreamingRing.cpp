@@ -0,0 +1,86 @@
+#include "StreamingRing.h"
+#include "../core/AetherTime.h"
+#include "../core/Log.h"
+
+namespace aether {
+
+    StreamingRing::StreamingRing(uint32_t regionSize, uint32_t regionCount, StreamingFenceBackend& fences)
+        : m_FenceBackend(fences), m_RegionSize(regionSize), m_Fences(regionCount, StreamingFenceBackend::NullFence)
+    {
+        AETHER_ASSERT(regionSize > 0 && regionCount > 0, "StreamingRing: needs at least one non-empty region");
+    }
+
+    StreamingRing::~StreamingRing()
+    {
+        for (StreamingFenceBackend::Fence fence : m_Fences)
+        {
+            if (fence != StreamingFenceBackend::NullFence)
+                m_FenceBackend.Delete(fence);
+        }
+    }
+
+    void StreamingRing::BeginFrame()
+    {
+        AcquireRegion((m_Region + 1) % GetRegionCount());
+    }
+
+    void StreamingRing::EndFrame()
+    {
+        if (m_Cursor == 0) return;
+
+        // A later fence covers everything an earlier one did
+        StreamingFenceBackend::Fence& fence = m_Fences[m_Region];
+        if (fence != StreamingFenceBackend::NullFence)
+            m_FenceBackend.Delete(fence);
+        fence = m_FenceBackend.Insert();
+    }
+
+    uint32_t StreamingRing::Allocate(uint32_t size, uint32_t alignment)
+    {
+        auto alignedOffset = [&]() {
+            uint32_t absolute = m_Region * m_RegionSize + m_Cursor;
+            return (absolute + alignment - 1) / alignment * alignment;
+        };
+
+        uint32_t offset = alignedOffset();
+        if (offset + size > (m_Region + 1) * m_RegionSize)
+        {
+            // Hand what was written so far to the GPU and continue in the next region
+            EndFrame();
+            AcquireRegion((m_Region + 1) % GetRegionCount());
+            m_Stats.Overflows++;
+
+            offset = alignedOffset();
+            if (offset + size > (m_Region + 1) * m_RegionSize)
+            {
+                AETHER_CORE_ERROR("StreamingRing: {0}-byte allocation does not fit in a {1}-byte region", size, m_RegionSize);
+                return InvalidOffset;
+            }
+        }
+
+        m_Cursor = offset + size - m_Region * m_RegionSize;
+        m_Stats.BytesWritten += size;
+        return offset;
+    }
+
+    void StreamingRing::AcquireRegion(uint32_t region)
+    {
+        StreamingFenceBackend::Fence& fence = m_Fences[region];
+        if (fence != StreamingFenceBackend::NullFence)
+        {
+            if (!m_FenceBackend.IsSignaled(fence))
+            {
+                double waitStart = AetherTime::Now();
+                m_FenceBackend.Wait(fence);
+                m_Stats.Stalls++;
+                m_Stats.WaitMs += (AetherTime::Now() - waitStart) * 1000.0;
+            }
+            m_FenceBackend.Delete(fence);
+            fence = StreamingFenceBackend::NullFence;
+        }
+
+        m_Region = region;
+        m_Cursor = 0;
+    }
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace aether {
+
+    // --- Streaming Fence Backend ---
+    // The GPU synchronisation StreamingRing needs, kept behind an interface so the
+    // region/fence bookkeeping runs (and can be checked) without a GL context.
+    class StreamingFenceBackend
+    {
+    public:
+        using Fence = uint64_t;
+        static constexpr Fence NullFence = 0;
+
+        virtual ~StreamingFenceBackend() = default;
+
+        // Fence after every command issued so far
+        virtual Fence Insert() = 0;
+        // Non-blocking poll
+        virtual bool IsSignaled(Fence fence) = 0;
+        // Blocks until the fence is signaled
+        virtual void Wait(Fence fence) = 0;
+        virtual void Delete(Fence fence) = 0;
+    };
+
+    // --- Streaming Ring ---
+    // Splits a buffer of RegionCount * RegionSize bytes into regions written in turn.
+    // EndFrame() fences the region the GPU is about to read; the region is not
+    // handed out again until that fence has signaled. A frame that outgrows its
+    // region spills into the next one early (counted as an overflow).
+    class StreamingRing
+    {
+    public:
+        static constexpr uint32_t DefaultRegionCount = 3; // Frames the CPU may run ahead of the GPU
+        static constexpr uint32_t InvalidOffset = 0xffffffff;
+
+        struct Statistics
+        {
+            uint32_t Stalls = 0;       // Times a region was still in use by the GPU
+            double WaitMs = 0.0;       // Time spent blocked on those fences
+            uint32_t Overflows = 0;    // Frames that spilled into the next region
+            uint64_t BytesWritten = 0;
+        };
+
+        StreamingRing(uint32_t regionSize, uint32_t regionCount, StreamingFenceBackend& fences);
+        ~StreamingRing();
+
+        StreamingRing(const StreamingRing&) = delete;
+        StreamingRing& operator=(const StreamingRing&) = delete;
+
+        // Moves to the next region, waiting on its fence if the GPU still owns it
+        void BeginFrame();
+        // Fences the current region; call after the draws that read it were issued
+        void EndFrame();
+
+        // Reserves size bytes in the current region, aligned relative to the buffer start.
+        // Returns the byte offset within the whole buffer, or InvalidOffset if size
+        // can never fit in one region.
+        uint32_t Allocate(uint32_t size, uint32_t alignment);
+
+        uint32_t GetRegionSize() const { return m_RegionSize; }
+        uint32_t GetRegionCount() const { return (uint32_t)m_Fences.size(); }
+        uint32_t GetBufferSize() const { return m_RegionSize * GetRegionCount(); }
+        uint32_t GetCurrentRegion() const { return m_Region; }
+
+        const Statistics& GetStats() const { return m_Stats; }
+        void ResetStats() { m_Stats = Statistics(); }
+
+    private:
+        void AcquireRegion(uint32_t region);
+
+    private:
+        StreamingFenceBackend& m_FenceBackend;
+        uint32_t m_RegionSize;
+        std::vector<StreamingFenceBackend::Fence> m_Fences; // One per region
+        uint32_t m_Region = 0;
+        uint32_t m_Cursor = 0; // Bytes used in the current region
+
+        Statistics m_Stats;
+    };
+
+}
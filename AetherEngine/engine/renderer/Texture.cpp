@@ -1,6 +1,12 @@
 #include "Texture.h"
+#include "GLStateCache.h"
+#include "TextureLoader.h"
+#include "CookedTexture.h"
 #include "../core/Log.h"
 #include <glad/glad.h>
+#include <fstream>
+#include <vector>
+#include <algorithm>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include "../vendor/stb_image.h"
@@ -27,26 +33,48 @@ namespace aether {
         return 0;
     }
 
+    // Minify through the chain; nearest stays nearest within a level (pixel art)
+    static GLint GetMinFilter(GLint filter, uint32_t mipCount)
+    {
+        if (mipCount <= 1)
+            return filter;
+        return filter == GL_NEAREST ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+    }
+
     Texture2D::Texture2D(const TextureSpecification& specification)
         : m_Specification(specification), m_Width(m_Specification.Width), m_Height(m_Specification.Height)
     {
         m_InternalFormat = ImageFormatToGLInternalFormat(m_Specification.Format);
         m_DataFormat = ImageFormatToGLDataFormat(m_Specification.Format);
+        m_MipCount = std::max(1u, m_Specification.MipLevels);
 
         glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-        glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
+        glTextureStorage2D(m_RendererID, m_MipCount, m_InternalFormat, m_Width, m_Height);
 
         // Apply Specification Settings
-        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, m_Specification.MinFilter);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GetMinFilter(m_Specification.MinFilter, m_MipCount));
         glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, m_Specification.MagFilter);
 
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, m_Specification.WrapS);
         glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, m_Specification.WrapT);
+        if (m_MipCount > 1)
+            glTextureParameteri(m_RendererID, GL_TEXTURE_MAX_LEVEL, (GLint)m_MipCount - 1);
     }
 
     Texture2D::Texture2D(const std::string& path, const TextureSpecification& specification)
         : m_Path(path), m_Specification(specification) // Copy defaults or overrides
     {
+        if (std::filesystem::path(path).extension() == ".aetex")
+        {
+            if (!LoadCooked(path))
+            {
+                AETHER_CORE_ERROR("Failed to load cooked texture at path: {}", path);
+                m_Loaded = false;
+                m_Failed = true;
+            }
+            return;
+        }
+
         int width, height, channels;
         stbi_set_flip_vertically_on_load(1);
         stbi_uc* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
@@ -94,23 +122,105 @@ namespace aether {
         else
         {
             AETHER_CORE_ERROR("Failed to load texture at path: {}", path);
+            m_Loaded = false;
+            m_Failed = true;
+        }
+    }
+
+    Texture2D::Texture2D(PendingTag, const std::string& path, const TextureSpecification& specification)
+        : m_Specification(specification), m_Path(path), m_Loaded(false)
+    {
+        const Texture2D& placeholder = TextureLoader::GetPlaceholder();
+        m_Width = placeholder.m_Width;
+        m_Height = placeholder.m_Height;
+        m_RendererID = placeholder.m_RendererID;
+        m_InternalFormat = placeholder.m_InternalFormat;
+        m_DataFormat = placeholder.m_DataFormat;
+    }
+
+    bool Texture2D::LoadCooked(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        CookedTextureHeader header;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(CookedTextureHeader));
+        if (!stream || !header.IsValid())
+            return false;
+
+        size_t chainSize = 0;
+        for (uint32_t level = 0; level < header.MipCount; level++)
+            chainSize += CookedTextureHeader::GetMipSize(header.Width, header.Height, level);
+
+        std::vector<uint8_t> chain(chainSize);
+        stream.read(reinterpret_cast<char*>(chain.data()), (std::streamsize)chainSize);
+        if (!stream)
+            return false;
+
+        m_Width = m_Specification.Width = header.Width;
+        m_Height = m_Specification.Height = header.Height;
+        m_Specification.Format = ImageFormat::RGBA8;
+        m_Specification.PremultipliedAlpha = (header.Flags & CookedTextureHeader::PremultipliedAlpha) != 0;
+        m_InternalFormat = GL_RGBA8;
+        m_DataFormat = GL_RGBA;
+        m_MipCount = header.MipCount;
+
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
+        glTextureStorage2D(m_RendererID, m_MipCount, m_InternalFormat, m_Width, m_Height);
+
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GetMinFilter(m_Specification.MinFilter, m_MipCount));
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, m_Specification.MagFilter);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, m_Specification.WrapS);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, m_Specification.WrapT);
+        glTextureParameteri(m_RendererID, GL_TEXTURE_MAX_LEVEL, (GLint)m_MipCount - 1);
+
+        const uint8_t* level = chain.data();
+        for (uint32_t i = 0; i < m_MipCount; i++)
+        {
+            glTextureSubImage2D(m_RendererID, (GLint)i, 0, 0,
+                CookedTextureHeader::GetMipDimension(m_Width, i), CookedTextureHeader::GetMipDimension(m_Height, i),
+                m_DataFormat, GL_UNSIGNED_BYTE, level);
+            level += CookedTextureHeader::GetMipSize(m_Width, m_Height, i);
         }
+        return true;
+    }
+
+    std::shared_ptr<Texture2D> Texture2D::LoadAsync(const std::string& path, const TextureSpecification& specification)
+    {
+        // Cooked files need no decode: reading them in place is cheaper than a round trip through the workers
+        if (!TextureLoader::IsInitialized() || std::filesystem::path(path).extension() == ".aetex")
+            return std::make_shared<Texture2D>(path, specification);
+
+        std::shared_ptr<Texture2D> texture(new Texture2D(PendingTag{}, path, specification));
+        TextureLoader::Request(texture.get());
+        return texture;
     }
 
     Texture2D::~Texture2D()
     {
+        // The placeholder's name is borrowed, not owned; a failed load owns nothing
+        if (!m_Loaded)
+        {
+            if (!m_Failed)
+                TextureLoader::Cancel(this);
+            return;
+        }
+
+        GLStateCache::OnTextureDeleted(m_RendererID);
         glDeleteTextures(1, &m_RendererID);
     }
 
-    void Texture2D::SetData(void* data, uint32_t size)
+    void Texture2D::SetData(void* data, uint32_t size, uint32_t level)
     {
+        AETHER_ASSERT(m_Loaded, "SetData on a texture that is still loading: {0}", m_Path);
+        AETHER_ASSERT(level < m_MipCount, "Mip level {0} out of range ({1} levels)", level, m_MipCount);
         uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
-        AETHER_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
-        glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+        uint32_t width = std::max(1u, m_Width >> level);
+        uint32_t height = std::max(1u, m_Height >> level);
+        AETHER_ASSERT(size == width * height * bpp, "Data must be entire texture!");
+        glTextureSubImage2D(m_RendererID, (GLint)level, 0, 0, width, height, m_DataFormat, GL_UNSIGNED_BYTE, data);
     }
 
     void Texture2D::Bind(uint32_t slot) const
     {
-        glBindTextureUnit(slot, m_RendererID);
+        GLStateCache::BindTextureUnit(slot, m_RendererID);
     }
 }
\ No newline at end of file
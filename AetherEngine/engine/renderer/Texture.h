@@ -2,6 +2,7 @@
 
 #include <string>
 #include <filesystem>
+#include <memory>
 #include <glad/glad.h>
 
 namespace aether {
@@ -32,6 +33,12 @@ namespace aether {
         // Wrapping (GL_REPEAT or GL_CLAMP_TO_EDGE)
         int WrapS = GL_REPEAT;
         int WrapT = GL_REPEAT;
+
+        // rgb already multiplied by alpha (cooked .aetex files say so in their header)
+        bool PremultipliedAlpha = false;
+
+        // Storage levels for an empty texture; fill each with SetData(data, size, level)
+        uint32_t MipLevels = 1;
     };
 
     class Texture2D
@@ -40,32 +47,59 @@ namespace aether {
         // Create an empty texture with specific settings (e.g. for Framebuffers)
         Texture2D(const TextureSpecification& specification);
 
-        // Create from file with specific settings
+        // Create from file with specific settings. A cooked .aetex (see CookedTexture.h)
+        // is read straight into storage with its mip chain; anything else is decoded.
         Texture2D(const std::string& path, const TextureSpecification& specification = TextureSpecification());
 
         ~Texture2D();
 
+        // Returns at once: the file decodes on a worker thread and uploads over the next
+        // frames, and until then the texture shows TextureLoader's placeholder. Falls back
+        // to a synchronous load when the loader is not running (e.g. no renderer).
+        static std::shared_ptr<Texture2D> LoadAsync(const std::string& path, const TextureSpecification& specification = TextureSpecification());
+
+        // False while an asynchronous load is still in flight, and after it failed
+        bool IsLoaded() const { return m_Loaded; }
+
+        // The file could not be read or decoded. An asynchronous load keeps showing the
+        // placeholder; a synchronous one has no GL texture at all.
+        bool IsFailed() const { return m_Failed; }
+
         const TextureSpecification& GetSpecification() const { return m_Specification; }
 
         uint32_t GetWidth() const { return m_Width; }
         uint32_t GetHeight() const { return m_Height; }
         uint32_t GetRendererID() const { return m_RendererID; }
+        uint32_t GetMipCount() const { return m_MipCount; }
+        bool IsPremultiplied() const { return m_Specification.PremultipliedAlpha; }
 
         const std::string& GetPath() const { return m_Path; }
 
-        // Uploads raw data to the GPU
-        void SetData(void* data, uint32_t size);
+        // Uploads raw data to the GPU: one whole mip level (max(1, Width >> level) wide)
+        void SetData(void* data, uint32_t size, uint32_t level = 0);
 
         // Binds the texture to a slot (0-31)
         void Bind(uint32_t slot = 0) const;
 
         bool operator==(const Texture2D& other) const { return m_RendererID == other.m_RendererID; }
 
+    private:
+        friend class TextureLoader;
+
+        // Pending texture for LoadAsync: borrows the placeholder until TextureLoader finishes
+        struct PendingTag {};
+        Texture2D(PendingTag, const std::string& path, const TextureSpecification& specification);
+
+        bool LoadCooked(const std::string& path);
+
     private:
         TextureSpecification m_Specification;
         std::string m_Path;
-        uint32_t m_Width, m_Height;
-        uint32_t m_RendererID;
-        GLenum m_InternalFormat, m_DataFormat;
+        uint32_t m_Width = 0, m_Height = 0;
+        uint32_t m_RendererID = 0;
+        GLenum m_InternalFormat = 0, m_DataFormat = 0;
+        uint32_t m_MipCount = 1;
+        bool m_Loaded = true;
+        bool m_Failed = false;
     };
 }
\ No newline at end of file
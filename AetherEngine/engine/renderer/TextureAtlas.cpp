@@ -0,0 +1,213 @@
+#include "TextureAtlas.h"
+#include "Texture.h"
+#include "CookedTexture.h"
+#include "../asset/AssetMetadata.h"
+#include "../core/Log.h"
+#include "../vendor/json.hpp"
+#include <fstream>
+
+using json = nlohmann::json;
+
+namespace aether {
+
+    struct AtlasRegistryStorage
+    {
+        std::vector<std::shared_ptr<TextureAtlas>> Atlases;
+        std::vector<Texture2D*> Pages; // Global page index -> texture
+        std::unordered_map<uint64_t, AtlasRegion> Regions;
+    };
+
+    static AtlasRegistryStorage s_Registry;
+
+    std::shared_ptr<TextureAtlas> TextureAtlas::Load(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            AETHER_CORE_ERROR("TextureAtlas: cannot open '{0}'", path.string());
+            return nullptr;
+        }
+
+        AssetHeader header;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(AssetHeader));
+        if (!stream || header.Type != AssetType::TextureAtlas)
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' is not a cooked texture atlas", path.string());
+            return nullptr;
+        }
+
+        // Everything after the size prefix: bounds the region table and the pages
+        const std::streampos bodyStart = stream.tellg() + (std::streamoff)sizeof(uint32_t);
+        stream.seekg(0, std::ios::end);
+        const std::streamoff fileRemaining = stream.tellg() - bodyStart;
+        stream.seekg(bodyStart - (std::streamoff)sizeof(uint32_t));
+
+        uint32_t jsonSize = 0;
+        stream.read(reinterpret_cast<char*>(&jsonSize), sizeof(jsonSize));
+        if (!stream || fileRemaining < 0 || jsonSize > (uint64_t)fileRemaining)
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' is truncated (region table)", path.string());
+            return nullptr;
+        }
+
+        std::string dump(jsonSize, '\0');
+        stream.read(dump.data(), jsonSize);
+
+        json meta = json::parse(dump, nullptr, false);
+        if (meta.is_discarded() || !meta.is_object())
+        {
+            AETHER_CORE_ERROR("TextureAtlas: corrupt region table in '{0}'", path.string());
+            return nullptr;
+        }
+
+        auto isUnsigned = [](const json& object, const char* key) {
+            return object.contains(key) && object[key].is_number_unsigned();
+        };
+
+        if (!isUnsigned(meta, "PageWidth") || !isUnsigned(meta, "PageHeight") || !isUnsigned(meta, "PageCount")
+            || !meta.contains("Regions") || !meta["Regions"].is_array())
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' is missing page or region fields", path.string());
+            return nullptr;
+        }
+
+        const uint32_t pageWidth = meta["PageWidth"].get<uint32_t>();
+        const uint32_t pageHeight = meta["PageHeight"].get<uint32_t>();
+        const uint32_t pageCount = meta["PageCount"].get<uint32_t>();
+
+        if (pageWidth == 0 || pageHeight == 0 || pageCount == 0)
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' has an empty page size or count", path.string());
+            return nullptr;
+        }
+
+        // Atlases cooked before mip chains have a single level of straight alpha
+        const uint32_t mipCount = isUnsigned(meta, "MipCount") ? meta["MipCount"].get<uint32_t>() : 1;
+        const bool premultiplied = meta.contains("Premultiplied") && meta["Premultiplied"].is_boolean() && meta["Premultiplied"].get<bool>();
+        if (mipCount == 0 || mipCount > CookedTextureHeader::GetFullMipCount(pageWidth, pageHeight))
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' has an invalid mip count ({1})", path.string(), mipCount);
+            return nullptr;
+        }
+
+        size_t pageBytes = 0;
+        for (uint32_t level = 0; level < mipCount; level++)
+            pageBytes += CookedTextureHeader::GetMipSize(pageWidth, pageHeight, level);
+
+        // Checked before allocating: a corrupt size must not turn into a huge buffer
+        if ((uint64_t)pageBytes * pageCount > (uint64_t)fileRemaining - jsonSize)
+        {
+            AETHER_CORE_ERROR("TextureAtlas: '{0}' is truncated ({1} pages of {2}x{3})", path.string(), pageCount, pageWidth, pageHeight);
+            return nullptr;
+        }
+
+        // Validate every region before any page reaches the GPU
+        for (const auto& entry : meta["Regions"])
+        {
+            bool valid = entry.is_object() && isUnsigned(entry, "Texture") && isUnsigned(entry, "Page")
+                && entry.contains("Rect") && entry["Rect"].is_array() && entry["Rect"].size() == 4;
+            if (valid)
+            {
+                for (const auto& value : entry["Rect"])
+                    valid = valid && value.is_number();
+            }
+            if (!valid || entry["Page"].get<uint64_t>() >= pageCount)
+            {
+                AETHER_CORE_ERROR("TextureAtlas: '{0}' has a malformed region entry", path.string());
+                return nullptr;
+            }
+        }
+
+        auto atlas = std::make_shared<TextureAtlas>();
+
+        // Pages are stored ready to upload: one read per page and one SetData per level
+        TextureSpecification spec;
+        spec.Width = pageWidth;
+        spec.Height = pageHeight;
+        spec.GenerateMips = false;
+        spec.MipLevels = mipCount;
+        spec.PremultipliedAlpha = premultiplied;
+        spec.WrapS = GL_CLAMP_TO_EDGE;
+        spec.WrapT = GL_CLAMP_TO_EDGE;
+
+        std::vector<uint8_t> pixels(pageBytes);
+        for (uint32_t i = 0; i < pageCount; i++)
+        {
+            stream.read(reinterpret_cast<char*>(pixels.data()), (std::streamsize)pageBytes);
+            if (!stream)
+            {
+                AETHER_CORE_ERROR("TextureAtlas: '{0}' is truncated (page {1} of {2})", path.string(), i, pageCount);
+                return nullptr;
+            }
+
+            auto page = std::make_shared<Texture2D>(spec);
+            size_t offset = 0;
+            for (uint32_t level = 0; level < mipCount; level++)
+            {
+                size_t levelBytes = CookedTextureHeader::GetMipSize(pageWidth, pageHeight, level);
+                page->SetData(pixels.data() + offset, (uint32_t)levelBytes, level);
+                offset += levelBytes;
+            }
+            atlas->m_Pages.push_back(page);
+        }
+
+        for (const auto& entry : meta["Regions"])
+        {
+            uint32_t pageIndex = entry["Page"].get<uint32_t>();
+            const auto& rect = entry["Rect"];
+            float x = rect[0].get<float>(), y = rect[1].get<float>();
+            float w = rect[2].get<float>(), h = rect[3].get<float>();
+
+            AtlasRegion region;
+            region.Page = atlas->m_Pages[pageIndex].get();
+            region.PageIndex = pageIndex;
+            region.UV = { x / pageWidth, y / pageHeight, (x + w) / pageWidth, (y + h) / pageHeight };
+            atlas->m_Regions[entry["Texture"].get<uint64_t>()] = region;
+        }
+
+        AETHER_CORE_INFO("TextureAtlas: loaded '{0}' ({1} regions, {2} pages)", path.filename().string(), atlas->m_Regions.size(), pageCount);
+        return atlas;
+    }
+
+    const AtlasRegion* TextureAtlas::FindRegion(uint64_t texture) const
+    {
+        auto it = m_Regions.find(texture);
+        return it != m_Regions.end() ? &it->second : nullptr;
+    }
+
+    void TextureAtlas::Register(const std::shared_ptr<TextureAtlas>& atlas)
+    {
+        if (!atlas) return;
+
+        // Rebase the atlas-local page indices onto the global page list
+        uint32_t firstPage = (uint32_t)s_Registry.Pages.size();
+        for (const auto& page : atlas->m_Pages)
+            s_Registry.Pages.push_back(page.get());
+
+        for (const auto& [texture, region] : atlas->m_Regions)
+        {
+            AtlasRegion global = region;
+            global.PageIndex += firstPage;
+            s_Registry.Regions[texture] = global;
+        }
+
+        s_Registry.Atlases.push_back(atlas);
+    }
+
+    void TextureAtlas::ClearRegistered()
+    {
+        s_Registry = {};
+    }
+
+    const AtlasRegion* TextureAtlas::Lookup(uint64_t texture)
+    {
+        auto it = s_Registry.Regions.find(texture);
+        return it != s_Registry.Regions.end() ? &it->second : nullptr;
+    }
+
+    Texture2D* TextureAtlas::GetGlobalPage(uint32_t pageIndex)
+    {
+        return pageIndex < s_Registry.Pages.size() ? s_Registry.Pages[pageIndex] : nullptr;
+    }
+
+}
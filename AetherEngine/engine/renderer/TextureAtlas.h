@@ -0,0 +1,46 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace aether {
+
+    class Texture2D;
+
+    // Where a source texture ended up inside a cooked atlas
+    struct AtlasRegion
+    {
+        Texture2D* Page = nullptr;
+        uint32_t PageIndex = 0;    // Global across every registered atlas (for draw bucketing)
+        glm::vec4 UV = { 0.0f, 0.0f, 1.0f, 1.0f }; // u0, v0, u1, v1
+    };
+
+    // --- Texture Atlas (runtime) ---
+    // Loads a TextureAtlas .aeth written by TextureAtlasCooker: uploads the pages
+    // as-is and builds the texture UUID -> region table. No packing at load time.
+    class TextureAtlas
+    {
+    public:
+        static std::shared_ptr<TextureAtlas> Load(const std::filesystem::path& path);
+
+        const AtlasRegion* FindRegion(uint64_t texture) const;
+        uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+
+        // --- Global Registry ---
+        // Sprites reference a texture UUID; the renderer resolves it through every
+        // registered atlas, so sprites sharing a page draw together.
+        static void Register(const std::shared_ptr<TextureAtlas>& atlas);
+        static void ClearRegistered();
+        static const AtlasRegion* Lookup(uint64_t texture);
+        static Texture2D* GetGlobalPage(uint32_t pageIndex);
+
+    private:
+        std::vector<std::shared_ptr<Texture2D>> m_Pages;
+        std::unordered_map<uint64_t, AtlasRegion> m_Regions;
+    };
+
+}
@@ -0,0 +1,216 @@
+#include "TextureLoader.h"
+#include "Texture.h"
+#include "StreamingBuffer.h"
+#include "../core/Log.h"
+#include <glad/glad.h>
+#include <unordered_map>
+#include <memory>
+
+namespace aether {
+
+    struct PendingTexture
+    {
+        Texture2D* Target;
+        TextureStreamer::RequestID Request;
+        GLuint Storage = 0; // Created with the first rows, adopted by Target after the last
+    };
+
+    struct TextureLoaderStorage
+    {
+        uint32_t UploadBudget = 0;
+
+        std::unique_ptr<TextureStreamer> Streamer;
+        std::unique_ptr<StreamingBuffer> UploadRing; // GL_PIXEL_UNPACK_BUFFER source
+        std::unique_ptr<Texture2D> Placeholder;
+
+        std::unordered_map<TextureStreamer::RequestID, PendingTexture> Pending;
+        std::unordered_map<Texture2D*, TextureStreamer::RequestID> Requests;
+    };
+
+    static TextureLoaderStorage* s_Loader = nullptr;
+
+    static void GetFormats(uint32_t channels, GLenum& internalFormat, GLenum& dataFormat)
+    {
+        internalFormat = channels == 4 ? GL_RGBA8 : GL_RGB8;
+        dataFormat = channels == 4 ? GL_RGBA : GL_RGB;
+    }
+
+    static GLuint CreateStorage(const Texture2D& target, const TextureStreamer::Image& image)
+    {
+        GLenum internalFormat, dataFormat;
+        GetFormats(image.Channels, internalFormat, dataFormat);
+
+        const TextureSpecification& spec = target.GetSpecification();
+
+        GLuint texture = 0;
+        glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+        glTextureStorage2D(texture, 1, internalFormat, image.Width, image.Height);
+        glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, spec.MinFilter);
+        glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, spec.MagFilter);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_S, spec.WrapS);
+        glTextureParameteri(texture, GL_TEXTURE_WRAP_T, spec.WrapT);
+        return texture;
+    }
+
+    void TextureLoader::Init(uint32_t uploadBudget)
+    {
+        AETHER_ASSERT(!s_Loader, "TextureLoader already initialized");
+        s_Loader = new TextureLoaderStorage();
+        s_Loader->UploadBudget = uploadBudget;
+
+        TextureSpecification spec;
+        spec.Width = 8;
+        spec.Height = 8;
+        spec.GenerateMips = false;
+        spec.MinFilter = GL_NEAREST;
+        spec.MagFilter = GL_NEAREST;
+        s_Loader->Placeholder = std::make_unique<Texture2D>(spec);
+
+        uint32_t pixels[8 * 8];
+        for (uint32_t y = 0; y < 8; y++)
+        {
+            for (uint32_t x = 0; x < 8; x++)
+                pixels[y * 8 + x] = ((x / 2 + y / 2) % 2) ? 0xff3c3c3c : 0xff282828;
+        }
+        s_Loader->Placeholder->SetData(pixels, sizeof(pixels));
+
+        // One budget's worth per region: a frame's uploads never spill into the next region
+        s_Loader->UploadRing = std::make_unique<StreamingBuffer>(uploadBudget);
+        s_Loader->Streamer = std::make_unique<TextureStreamer>();
+
+        AETHER_CORE_INFO("TextureLoader: {0} decode worker(s), {1} KB upload budget per frame",
+            s_Loader->Streamer->GetWorkerCount(), uploadBudget / 1024);
+    }
+
+    void TextureLoader::Shutdown()
+    {
+        if (!s_Loader) return;
+
+        // Textures still loading keep the (now deleted) placeholder name and never own it
+        s_Loader->Streamer.reset();
+        for (auto& [request, pending] : s_Loader->Pending)
+        {
+            if (pending.Storage)
+                glDeleteTextures(1, &pending.Storage);
+        }
+
+        delete s_Loader;
+        s_Loader = nullptr;
+    }
+
+    bool TextureLoader::IsInitialized()
+    {
+        return s_Loader != nullptr;
+    }
+
+    const Texture2D& TextureLoader::GetPlaceholder()
+    {
+        AETHER_ASSERT(s_Loader, "TextureLoader not initialized");
+        return *s_Loader->Placeholder;
+    }
+
+    TextureStreamer::Statistics TextureLoader::GetStats()
+    {
+        return s_Loader ? s_Loader->Streamer->GetStats() : TextureStreamer::Statistics();
+    }
+
+    void TextureLoader::Request(Texture2D* texture)
+    {
+        TextureStreamer::RequestID request = s_Loader->Streamer->Request(texture->GetPath());
+        s_Loader->Pending[request] = { texture, request };
+        s_Loader->Requests[texture] = request;
+    }
+
+    void TextureLoader::Cancel(Texture2D* texture)
+    {
+        if (!s_Loader) return;
+
+        auto it = s_Loader->Requests.find(texture);
+        if (it == s_Loader->Requests.end()) return;
+
+        const TextureStreamer::RequestID request = it->second;
+        s_Loader->Requests.erase(it);
+        s_Loader->Streamer->Cancel(request);
+
+        auto pending = s_Loader->Pending.find(request);
+        if (pending != s_Loader->Pending.end())
+        {
+            if (pending->second.Storage)
+                glDeleteTextures(1, &pending->second.Storage);
+            s_Loader->Pending.erase(pending);
+        }
+    }
+
+    void TextureLoader::Update()
+    {
+        if (!s_Loader) return;
+
+        // A file that failed to decode keeps showing the placeholder, flagged so callers stop waiting
+        for (TextureStreamer::RequestID request : s_Loader->Streamer->TakeFailed())
+        {
+            auto it = s_Loader->Pending.find(request);
+            if (it == s_Loader->Pending.end()) continue;
+            it->second.Target->m_Failed = true;
+            s_Loader->Requests.erase(it->second.Target);
+            s_Loader->Pending.erase(it);
+        }
+
+        const auto& chunks = s_Loader->Streamer->PlanUploads(s_Loader->UploadBudget);
+        if (chunks.empty()) return;
+
+        StreamingBuffer& ring = *s_Loader->UploadRing;
+        ring.BeginFrame();
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.GetRendererID());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1); // RGB rows are not 4-byte multiples
+
+        for (const TextureStreamer::UploadChunk& chunk : chunks)
+        {
+            auto it = s_Loader->Pending.find(chunk.Request);
+            if (it == s_Loader->Pending.end()) continue;
+
+            PendingTexture& pending = it->second;
+            const TextureStreamer::Image& image = *chunk.Source;
+            if (!pending.Storage)
+                pending.Storage = CreateStorage(*pending.Target, image);
+
+            GLenum internalFormat, dataFormat;
+            GetFormats(image.Channels, internalFormat, dataFormat);
+
+            uint32_t offset = ring.Write(chunk.GetData(), chunk.GetSize(), 4);
+            if (offset != StreamingRing::InvalidOffset)
+            {
+                glTextureSubImage2D(pending.Storage, 0, 0, chunk.FirstRow, image.Width, chunk.RowCount,
+                    dataFormat, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>((uintptr_t)offset));
+            }
+            else
+            {
+                // A single row larger than the whole budget: upload it from client memory
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                glTextureSubImage2D(pending.Storage, 0, 0, chunk.FirstRow, image.Width, chunk.RowCount,
+                    dataFormat, GL_UNSIGNED_BYTE, chunk.GetData());
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.GetRendererID());
+            }
+
+            if (!chunk.Last) continue;
+
+            // Every row is queued ahead of any draw that samples it: swap the placeholder out
+            Texture2D& target = *pending.Target;
+            target.m_RendererID = pending.Storage;
+            target.m_Width = target.m_Specification.Width = image.Width;
+            target.m_Height = target.m_Specification.Height = image.Height;
+            target.m_InternalFormat = internalFormat;
+            target.m_DataFormat = dataFormat;
+            target.m_Loaded = true;
+
+            s_Loader->Requests.erase(pending.Target);
+            s_Loader->Pending.erase(it);
+        }
+
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        ring.EndFrame();
+    }
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "TextureStreamer.h"
+#include <cstdint>
+
+namespace aether {
+
+    class Texture2D;
+
+    // --- Texture Loader ---
+    // The GL half of Texture2D::LoadAsync. TextureStreamer decodes on worker threads;
+    // Update() (GL thread, once per frame) copies the rows it plans for this frame into
+    // a persistently mapped pixel-unpack ring (StreamingBuffer) and issues
+    // glTextureSubImage2D from there, so neither decoding nor a large upload lands on
+    // one frame. A texture switches from the placeholder to its own storage only once
+    // every row is on the GPU.
+    class TextureLoader
+    {
+    public:
+        static constexpr uint32_t DefaultUploadBudget = 4 * 1024 * 1024; // Bytes per frame
+
+        static void Init(uint32_t uploadBudget = DefaultUploadBudget);
+        static void Shutdown();
+        static bool IsInitialized();
+
+        static void Update();
+
+        // Grey checkerboard shown by textures that are still loading
+        static const Texture2D& GetPlaceholder();
+
+        static TextureStreamer::Statistics GetStats();
+
+    private:
+        friend class Texture2D;
+
+        static void Request(Texture2D* texture);
+        static void Cancel(Texture2D* texture);
+    };
+
+}
@@ -0,0 +1,205 @@
+#include "TextureStreamer.h"
+#include "../core/AetherTime.h"
+#include "../core/Log.h"
+#include "../vendor/stb_image.h"
+#include <algorithm>
+#include <utility>
+
+namespace aether {
+
+    static void FreePixels(uint8_t* pixels)
+    {
+        stbi_image_free(pixels);
+    }
+
+    // Texture2D only takes RGB8/RGBA8: grey and grey-alpha files are expanded to RGBA
+    static bool DecodeImage(const std::filesystem::path& path, TextureStreamer::Image& image)
+    {
+        const std::string file = path.string();
+
+        int width = 0, height = 0, channels = 0;
+        if (!stbi_info(file.c_str(), &width, &height, &channels))
+            return false;
+
+        const int desired = channels >= 3 ? 0 : 4;
+        stbi_uc* pixels = stbi_load(file.c_str(), &width, &height, &channels, desired);
+        if (!pixels)
+            return false;
+
+        image.Width = (uint32_t)width;
+        image.Height = (uint32_t)height;
+        image.Channels = desired ? (uint32_t)desired : (uint32_t)channels;
+        image.Pixels = std::unique_ptr<uint8_t, void(*)(uint8_t*)>(pixels, &FreePixels);
+        return true;
+    }
+
+    TextureStreamer::TextureStreamer(uint32_t workerCount)
+    {
+        if (workerCount == 0)
+        {
+            uint32_t hardware = std::thread::hardware_concurrency();
+            workerCount = std::clamp(hardware > 1 ? hardware - 1 : 1u, 1u, 4u);
+        }
+
+        for (uint32_t i = 0; i < workerCount; i++)
+            m_Workers.emplace_back(&TextureStreamer::WorkerLoop, this);
+    }
+
+    TextureStreamer::~TextureStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Quit = true;
+        }
+        m_WorkReady.notify_all();
+        for (std::thread& worker : m_Workers)
+            worker.join();
+    }
+
+    TextureStreamer::RequestID TextureStreamer::Request(const std::filesystem::path& path)
+    {
+        RequestID request = m_NextRequest++;
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Queue.emplace_back(request, path);
+            m_Stats.Requested++;
+        }
+        m_WorkReady.notify_one();
+        return request;
+    }
+
+    void TextureStreamer::Cancel(RequestID request)
+    {
+        auto matches = [request](const DecodedImage& image) { return image.Request == request; };
+
+        // Chunks planned this frame may still point at the pixels: retire rather than free
+        auto uploading = std::find_if(m_Uploading.begin(), m_Uploading.end(), matches);
+        if (uploading != m_Uploading.end())
+        {
+            m_Retired.push_back(std::move(uploading->Source));
+            m_Uploading.erase(uploading);
+        }
+
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Queue.erase(std::remove_if(m_Queue.begin(), m_Queue.end(),
+            [request](const auto& entry) { return entry.first == request; }), m_Queue.end());
+        m_Decoded.erase(std::remove_if(m_Decoded.begin(), m_Decoded.end(), matches), m_Decoded.end());
+        m_Failed.erase(std::remove(m_Failed.begin(), m_Failed.end(), request), m_Failed.end());
+
+        if (m_Decoding.count(request))
+            m_Cancelled.insert(request);
+    }
+
+    const std::vector<TextureStreamer::UploadChunk>& TextureStreamer::PlanUploads(uint32_t budgetBytes)
+    {
+        m_Chunks.clear();
+        m_Retired.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            for (DecodedImage& image : m_Decoded)
+                m_Uploading.push_back(std::move(image));
+            m_Decoded.clear();
+        }
+
+        uint64_t remaining = budgetBytes;
+        uint64_t planned = 0;
+        while (!m_Uploading.empty())
+        {
+            DecodedImage& image = m_Uploading.front();
+            const uint32_t rowSize = image.Source->GetRowSize();
+
+            // Out of budget; a frame that has uploaded nothing yet still takes one row
+            if (remaining < rowSize && !m_Chunks.empty())
+                break;
+
+            const uint32_t rowsLeft = image.Source->Height - image.NextRow;
+            const uint32_t rows = (uint32_t)std::min<uint64_t>(rowsLeft, std::max<uint64_t>(remaining / rowSize, 1));
+            const bool last = rows == rowsLeft;
+
+            m_Chunks.push_back({ image.Request, image.Source.get(), image.NextRow, rows, last });
+            image.NextRow += rows;
+
+            const uint64_t bytes = (uint64_t)rows * rowSize;
+            planned += bytes;
+            remaining -= std::min(remaining, bytes);
+
+            if (last)
+            {
+                m_Retired.push_back(std::move(image.Source));
+                m_Uploading.pop_front();
+            }
+
+            if (remaining == 0)
+                break;
+        }
+
+        if (planned)
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_Stats.UploadedBytes += planned;
+        }
+        return m_Chunks;
+    }
+
+    std::vector<TextureStreamer::RequestID> TextureStreamer::TakeFailed()
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        return std::exchange(m_Failed, {});
+    }
+
+    TextureStreamer::Statistics TextureStreamer::GetStats() const
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Statistics stats = m_Stats;
+        stats.Pending = (uint32_t)(m_Queue.size() + m_Decoding.size() + m_Decoded.size() + m_Uploading.size());
+        return stats;
+    }
+
+    void TextureStreamer::WorkerLoop()
+    {
+        // Thread-local flag: leaves the global one (synchronous Texture2D loads) alone
+        stbi_set_flip_vertically_on_load_thread(1);
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        while (true)
+        {
+            m_WorkReady.wait(lock, [this] { return m_Quit || !m_Queue.empty(); });
+            if (m_Quit)
+                return;
+
+            auto [request, path] = std::move(m_Queue.front());
+            m_Queue.pop_front();
+            m_Decoding.insert(request);
+            lock.unlock();
+
+            double start = AetherTime::Now();
+            auto image = std::make_unique<Image>();
+            bool decoded = DecodeImage(path, *image);
+            double elapsedMs = (AetherTime::Now() - start) * 1000.0;
+
+            if (!decoded)
+                AETHER_CORE_ERROR("TextureStreamer: failed to decode '{0}': {1}", path.string(), stbi_failure_reason());
+
+            lock.lock();
+            m_Decoding.erase(request);
+            m_Stats.DecodeMs += elapsedMs;
+
+            if (m_Cancelled.erase(request))
+                continue;
+
+            if (decoded)
+            {
+                m_Stats.Decoded++;
+                m_Stats.DecodedBytes += (uint64_t)image->GetRowSize() * image->Height;
+                m_Decoded.push_back({ request, std::move(image) });
+            }
+            else
+            {
+                m_Stats.Failed++;
+                m_Failed.push_back(request);
+            }
+        }
+    }
+
+}
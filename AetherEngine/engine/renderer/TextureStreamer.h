@@ -0,0 +1,114 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <deque>
+#include <unordered_set>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace aether {
+
+    // --- Texture Streamer ---
+    // The GL-free half of asynchronous texture loading. Worker threads decode image
+    // files; PlanUploads() then slices decoded images into row ranges that fit a
+    // per-frame byte budget. TextureLoader feeds those ranges to the GPU, but nothing
+    // here needs a context, so decode throughput and budgeting can be measured headless.
+    //
+    // Request, Cancel, PlanUploads and TakeFailed belong to one thread (the GL thread).
+    class TextureStreamer
+    {
+    public:
+        using RequestID = uint64_t;
+
+        // Tightly packed rows, bottom row first (flipped for GL like Texture2D), 3 or 4 channels
+        struct Image
+        {
+            uint32_t Width = 0;
+            uint32_t Height = 0;
+            uint32_t Channels = 0;
+            std::unique_ptr<uint8_t, void(*)(uint8_t*)> Pixels{ nullptr, nullptr };
+
+            uint32_t GetRowSize() const { return Width * Channels; }
+        };
+
+        struct UploadChunk
+        {
+            RequestID Request;
+            const Image* Source; // Valid until the next PlanUploads()
+            uint32_t FirstRow;
+            uint32_t RowCount;
+            bool Last;           // Final rows of this image
+
+            const uint8_t* GetData() const { return Source->Pixels.get() + (size_t)FirstRow * Source->GetRowSize(); }
+            uint32_t GetSize() const { return RowCount * Source->GetRowSize(); }
+        };
+
+        struct Statistics
+        {
+            uint32_t Requested = 0;
+            uint32_t Decoded = 0;
+            uint32_t Failed = 0;
+            uint64_t DecodedBytes = 0;
+            double DecodeMs = 0.0;     // Summed over workers
+            uint64_t UploadedBytes = 0; // Handed out by PlanUploads
+            uint32_t Pending = 0;      // Queued, decoding or partially uploaded
+        };
+
+        // 0 workers: one per spare hardware thread, at most four
+        explicit TextureStreamer(uint32_t workerCount = 0);
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer&) = delete;
+        TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+        RequestID Request(const std::filesystem::path& path);
+        void Cancel(RequestID request);
+
+        // Oldest image first. Each call hands out at most budgetBytes (but always at
+        // least one row, so an image wider than the budget still makes progress).
+        const std::vector<UploadChunk>& PlanUploads(uint32_t budgetBytes);
+
+        // Requests whose file could not be decoded since the last call
+        std::vector<RequestID> TakeFailed();
+
+        Statistics GetStats() const;
+        uint32_t GetWorkerCount() const { return (uint32_t)m_Workers.size(); }
+
+    private:
+        void WorkerLoop();
+
+        struct DecodedImage
+        {
+            RequestID Request;
+            std::unique_ptr<Image> Source;
+            uint32_t NextRow = 0;
+        };
+
+    private:
+        std::vector<std::thread> m_Workers;
+
+        mutable std::mutex m_Mutex;
+        std::condition_variable m_WorkReady;
+        bool m_Quit = false;
+
+        // Shared with the workers (under m_Mutex)
+        std::deque<std::pair<RequestID, std::filesystem::path>> m_Queue;
+        std::unordered_set<RequestID> m_Decoding;
+        std::unordered_set<RequestID> m_Cancelled; // Cancelled while a worker had them
+        std::deque<DecodedImage> m_Decoded;
+        std::vector<RequestID> m_Failed;
+        Statistics m_Stats;
+
+        // Planner thread only
+        RequestID m_NextRequest = 1;
+        std::deque<DecodedImage> m_Uploading;
+        std::vector<std::unique_ptr<Image>> m_Retired; // Fully planned; freed on the next call
+        std::vector<UploadChunk> m_Chunks;
+    };
+
+}
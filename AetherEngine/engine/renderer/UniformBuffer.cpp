@@ -0,0 +1,29 @@
+#include "UniformBuffer.h"
+#include "../core/Log.h"
+#include <glad/glad.h>
+
+namespace aether {
+
+    UniformBuffer::UniformBuffer(uint32_t size, uint32_t binding)
+        : m_Size(size), m_Binding(binding)
+    {
+        glCreateBuffers(1, &m_RendererID);
+        glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, binding, m_RendererID);
+
+        AETHER_CORE_TRACE("UniformBuffer Created: ID {0} (Size: {1} bytes, Binding: {2})", m_RendererID, size, binding);
+    }
+
+    UniformBuffer::~UniformBuffer()
+    {
+        AETHER_CORE_TRACE("Deleting UniformBuffer: ID {0}", m_RendererID);
+        glDeleteBuffers(1, &m_RendererID);
+    }
+
+    void UniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+    {
+        AETHER_ASSERT(offset + size <= m_Size, "UniformBuffer: write of {0} bytes at {1} overflows {2}-byte buffer", size, offset, m_Size);
+        glNamedBufferSubData(m_RendererID, offset, size, data);
+    }
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+namespace aether {
+
+    // Fixed binding points shared by C++ and GLSL (layout(std140, binding = N))
+    namespace UniformBinding {
+        constexpr uint32_t Camera = 0;
+    }
+
+    // --- Uniform Buffer ---
+    // A std140 block bound to a fixed binding point. Every shader that declares
+    // the block at that binding reads the same data, so per-frame values (camera)
+    // are uploaded once instead of once per shader.
+    class UniformBuffer
+    {
+    public:
+        UniformBuffer(uint32_t size, uint32_t binding);
+        ~UniformBuffer();
+
+        void SetData(const void* data, uint32_t size, uint32_t offset = 0);
+
+        uint32_t GetBinding() const { return m_Binding; }
+
+    private:
+        uint32_t m_RendererID = 0;
+        uint32_t m_Size;
+        uint32_t m_Binding;
+    };
+
+}
@@ -1,4 +1,5 @@
 #include "VertexArray.h"
+#include "GLStateCache.h"
 #include "../core/Log.h"
 #include <glad/glad.h>
 
@@ -33,31 +34,49 @@ namespace aether {
     VertexArray::~VertexArray()
     {
         AETHER_CORE_TRACE("Deleting VertexArray: ID {0}", m_RendererID);
+        GLStateCache::OnVertexArrayDeleted(m_RendererID);
         glDeleteVertexArrays(1, &m_RendererID);
     }
 
     void VertexArray::Bind() const
     {
-        glBindVertexArray(m_RendererID);
+        GLStateCache::BindVertexArray(m_RendererID);
     }
 
     void VertexArray::Unbind() const
     {
-        glBindVertexArray(0);
+        GLStateCache::BindVertexArray(0);
     }
 
     void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer)
     {
         AETHER_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
-        glBindVertexArray(m_RendererID);
+        GLStateCache::BindVertexArray(m_RendererID);
         vertexBuffer->Bind();
+        AddAttributes(vertexBuffer->GetLayout());
 
-        const auto& layout = vertexBuffer->GetLayout();
-        uint32_t index = 0;
+        m_VertexBuffers.push_back(vertexBuffer);
+    }
+
+    void VertexArray::AddVertexBuffer(const std::shared_ptr<StreamingBuffer>& streamingBuffer)
+    {
+        AETHER_ASSERT(streamingBuffer->GetLayout().GetElements().size(), "Streaming Buffer has no layout!");
+
+        GLStateCache::BindVertexArray(m_RendererID);
+        streamingBuffer->Bind();
+        AddAttributes(streamingBuffer->GetLayout());
 
+        m_StreamingBuffers.push_back(streamingBuffer);
+    }
+
+    void VertexArray::AddAttributes(const BufferLayout& layout)
+    {
+        // Locations continue from the previous buffer, so a second (e.g. per-instance)
+        // buffer does not overwrite the first buffer's attributes.
         for (const auto& element : layout)
         {
+            uint32_t index = m_VertexAttribIndex;
             glEnableVertexAttribArray(index);
             glVertexAttribPointer(index,
                 element.GetComponentCount(),
@@ -65,17 +84,16 @@ namespace aether {
                 element.Normalized ? GL_TRUE : GL_FALSE,
                 layout.GetStride(),
                 (const void*)element.Offset);
+            glVertexAttribDivisor(index, layout.GetDivisor());
 
-            AETHER_CORE_TRACE("VAO {0}: Enabled Attribute {1} ({2})", m_RendererID, index, element.Name);
-            index++;
+            AETHER_CORE_TRACE("VAO {0}: Enabled Attribute {1} ({2}, divisor {3})", m_RendererID, index, element.Name, layout.GetDivisor());
+            m_VertexAttribIndex++;
         }
-
-        m_VertexBuffers.push_back(vertexBuffer);
     }
 
     void VertexArray::SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer)
     {
-        glBindVertexArray(m_RendererID);
+        GLStateCache::BindVertexArray(m_RendererID);
         indexBuffer->Bind();
 
         m_IndexBuffer = indexBuffer;
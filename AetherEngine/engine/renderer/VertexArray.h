@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Buffer.h"
+#include "StreamingBuffer.h"
 #include <memory> // For std::shared_ptr
 
 namespace aether {
@@ -19,14 +20,21 @@ namespace aether {
         void Unbind() const;
 
         void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer);
+        void AddVertexBuffer(const std::shared_ptr<StreamingBuffer>& streamingBuffer);
         void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer);
 
         const std::vector<std::shared_ptr<VertexBuffer>>& GetVertexBuffers() const { return m_VertexBuffers; }
         const std::shared_ptr<IndexBuffer>& GetIndexBuffer() const { return m_IndexBuffer; }
 
+    private:
+        // Declares layout's attributes against the buffer currently bound to GL_ARRAY_BUFFER
+        void AddAttributes(const BufferLayout& layout);
+
     private:
         uint32_t m_RendererID;
+        uint32_t m_VertexAttribIndex = 0; // Next free attribute location across all buffers
         std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
+        std::vector<std::shared_ptr<StreamingBuffer>> m_StreamingBuffers;
         std::shared_ptr<IndexBuffer> m_IndexBuffer;
     };
 
@@ -2,12 +2,21 @@
 #include "../ecs/Components.h"
 #include "../ecs/Entity.h"
 #include "../core/Log.h"
-#include "../renderer/Renderer2D.h"
+#include "../renderer/RenderThread.h"
+#include "../core/Engine.h"
+#include "../renderer/TextureAtlas.h"
 #include <glm/glm.hpp>
+#include <unordered_map>
 
 namespace aether {
 
     Scene::Scene() {
+        m_RenderQuery = m_Registry.RegisterQuery<SpriteComponent, TransformComponent>(Exclude<DisabledTag>{});
+        m_SimulationLOD.Init(m_Registry, m_Scheduler);
+
+        // Fields looked up by value at runtime
+        m_Registry.RegisterIndex<&CameraComponent::Primary>();
+        m_Registry.RegisterIndex<&TransformComponent::Replication>();
         AETHER_CORE_INFO("Scene System Initialized");
     }
 
@@ -20,6 +29,7 @@ namespace aether {
         auto& tag = entity.AddComponent<TagComponent>();
         tag.Tag = name.empty() ? "Entity" : name;
         entity.AddComponent<TransformComponent>();
+        entity.AddComponent<RelationshipComponent>();
 
         AETHER_CORE_TRACE("Created Entity: '{0}' (ID: {1})", tag.Tag, (uint32_t)entity.GetID());
         return entity;
@@ -27,7 +37,166 @@ namespace aether {
 
     void Scene::DestroyEntity(Entity entity) {
         AETHER_ASSERT((bool)entity, "Attempted to destroy an invalid entity!");
-        m_Registry.DestroyEntity(entity);
+        m_Registry.DestroyEntity(entity.GetID());
+    }
+
+    Entity Scene::GetPrimaryCameraEntity() {
+        const std::vector<EntityID>& primaries = m_Registry.FindByField<&CameraComponent::Primary>(true);
+        if (primaries.empty()) return {};
+        return { primaries.front(), &m_Registry };
+    }
+
+    // --- Hierarchy ---
+
+    void Scene::GatherSubtree(EntityID root, std::vector<EntityID>& out) {
+        auto* relationships = m_Registry.GetPool<RelationshipComponent>();
+
+        // Explicit stack: deep hierarchies must not recurse. Children are pushed in
+        // reverse so they pop in sibling order, keeping the output depth-first.
+        std::vector<EntityID> stack{ root };
+        std::vector<EntityID> children;
+        while (!stack.empty()) {
+            EntityID current = stack.back();
+            stack.pop_back();
+            out.push_back(current);
+
+            RelationshipComponent* rel = relationships->Get(current);
+            if (!rel) continue;
+
+            children.clear();
+            for (EntityID child = rel->FirstChild; child != NULL_ENTITY; ) {
+                children.push_back(child);
+                RelationshipComponent* childRel = relationships->Get(child);
+                child = childRel ? childRel->NextSibling : NULL_ENTITY;
+            }
+            stack.insert(stack.end(), children.rbegin(), children.rend());
+        }
+    }
+
+    // Removes the entity from its parent's child list and clears its sibling links
+    static void DetachFromParent(ComponentPool<RelationshipComponent>* relationships, EntityID entity) {
+        RelationshipComponent* rel = relationships->Get(entity);
+        if (!rel || rel->Parent == NULL_ENTITY) return;
+
+        if (RelationshipComponent* prev = relationships->Get(rel->PreviousSibling))
+            prev->NextSibling = rel->NextSibling;
+        if (RelationshipComponent* next = relationships->Get(rel->NextSibling))
+            next->PreviousSibling = rel->PreviousSibling;
+
+        if (RelationshipComponent* parent = relationships->Get(rel->Parent)) {
+            if (parent->FirstChild == entity)
+                parent->FirstChild = rel->NextSibling;
+            if (parent->ChildrenCount > 0)
+                parent->ChildrenCount--;
+        }
+
+        rel->Parent = NULL_ENTITY;
+        rel->PreviousSibling = NULL_ENTITY;
+        rel->NextSibling = NULL_ENTITY;
+    }
+
+    // Links a detached entity in as the parent's first child (O(1), no sibling walk)
+    static void AttachToParent(ComponentPool<RelationshipComponent>* relationships, EntityID entity, EntityID parentID) {
+        RelationshipComponent* rel = relationships->Get(entity);
+        RelationshipComponent* parent = relationships->Get(parentID);
+        AETHER_ASSERT(rel && parent, "AttachToParent: both entities need a RelationshipComponent");
+
+        rel->Parent = parentID;
+        rel->PreviousSibling = NULL_ENTITY;
+        rel->NextSibling = parent->FirstChild;
+        if (RelationshipComponent* oldFirst = relationships->Get(parent->FirstChild))
+            oldFirst->PreviousSibling = entity;
+
+        parent->FirstChild = entity;
+        parent->ChildrenCount++;
+    }
+
+    void Scene::DestroySubtree(Entity root) {
+        AETHER_ASSERT((bool)root, "Attempted to destroy an invalid subtree!");
+
+        std::vector<EntityID> subtree;
+        GatherSubtree(root.GetID(), subtree);
+
+        // Links inside the subtree die with it; only the root is visible from outside
+        DetachFromParent(m_Registry.GetPool<RelationshipComponent>(), root.GetID());
+        m_Registry.DestroyEntities(subtree);
+
+        AETHER_CORE_TRACE("Destroyed subtree of {0} entities (root ID: {1})", subtree.size(), (uint32_t)root.GetID());
+    }
+
+    Entity Scene::CloneSubtree(Entity root) {
+        AETHER_ASSERT((bool)root, "Attempted to clone an invalid subtree!");
+
+        std::vector<EntityID> source;
+        GatherSubtree(root.GetID(), source);
+
+        // One atomic step for the whole subtree
+        std::vector<EntityID> clones(source.size());
+        std::unordered_map<EntityID, EntityID> remap;
+        remap.reserve(source.size());
+        EntityID firstClone = m_Registry.ReserveEntityBlock((uint32_t)source.size());
+        for (size_t i = 0; i < source.size(); i++) {
+            clones[i] = firstClone + (EntityID)i;
+            remap[source[i]] = clones[i];
+        }
+
+        m_Registry.CloneEntities(source, clones);
+
+        // Copied links still point into the source subtree; redirect them to the clones.
+        // Links leaving the subtree (the root's parent/siblings) are handled below.
+        auto* relationships = m_Registry.GetPool<RelationshipComponent>();
+        auto mapID = [&](EntityID id) {
+            auto it = remap.find(id);
+            return it != remap.end() ? it->second : NULL_ENTITY;
+        };
+        for (EntityID clone : clones) {
+            RelationshipComponent* rel = relationships->Get(clone);
+            if (!rel) continue;
+            rel->Parent = mapID(rel->Parent);
+            rel->FirstChild = mapID(rel->FirstChild);
+            rel->PreviousSibling = mapID(rel->PreviousSibling);
+            rel->NextSibling = mapID(rel->NextSibling);
+        }
+
+        // The clone becomes a sibling of the original
+        RelationshipComponent* sourceRel = relationships->Get(root.GetID());
+        if (sourceRel && sourceRel->Parent != NULL_ENTITY)
+            AttachToParent(relationships, clones[0], sourceRel->Parent);
+
+        AETHER_CORE_TRACE("Cloned subtree of {0} entities (root ID: {1} -> {2})", source.size(), (uint32_t)root.GetID(), (uint32_t)clones[0]);
+        return { clones[0], &m_Registry };
+    }
+
+    bool Scene::Reparent(Entity child, Entity newParent) {
+        AETHER_ASSERT((bool)child, "Attempted to reparent an invalid entity!");
+
+        EntityID childID = child.GetID();
+        EntityID parentID = newParent ? newParent.GetID() : NULL_ENTITY;
+
+        auto* relationships = m_Registry.GetPool<RelationshipComponent>();
+        if (!relationships->Has(childID))
+            m_Registry.AddComponent<RelationshipComponent>(childID, {});
+        if (parentID != NULL_ENTITY && !relationships->Has(parentID))
+            m_Registry.AddComponent<RelationshipComponent>(parentID, {});
+
+        if (relationships->Get(childID)->Parent == parentID)
+            return true;
+
+        // Walk up from the new parent: reaching the child means we would create a cycle
+        for (EntityID ancestor = parentID; ancestor != NULL_ENTITY; ) {
+            if (ancestor == childID) {
+                AETHER_CORE_WARN("Cannot reparent entity {0} under its own descendant {1}", (uint32_t)childID, (uint32_t)parentID);
+                return false;
+            }
+            RelationshipComponent* rel = relationships->Get(ancestor);
+            ancestor = rel ? rel->Parent : NULL_ENTITY;
+        }
+
+        DetachFromParent(relationships, childID);
+        if (parentID != NULL_ENTITY)
+            AttachToParent(relationships, childID, parentID);
+
+        return true;
     }
 
     void Scene::OnUpdate(TimeStep ts, const glm::mat4& viewProjection) {
@@ -36,35 +205,129 @@ namespace aether {
 
         // --- Logic Systems ---
         // (Physics, Scripts, and other non-graphical systems run here on both Client and Server)
+#ifndef AETHER_SERVER
+        // The camera is the local observer; the server feeds client positions instead
+        glm::vec4 cameraCenter = glm::inverse(viewProjection) * glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        m_SimulationLOD.SetCameraObserver({ cameraCenter.x, cameraCenter.y });
+#endif
+        // Due marks first, so the scheduler's ticked systems skip entities that are
+        // dormant or on an off-tick of their tier
+        m_SimulationLOD.BeginTick(m_TickIndex);
+        m_Scheduler.Update(m_Registry, dt, m_TickIndex);
+        m_TickIndex++;
 
         // --- Rendering System (Client/Editor Only) ---
+        // Extraction copies everything the backend needs into the packet, so the
+        // registry is free to change again right away. The engine submits the packet
+        // once per frame, after the UI.
 #ifndef AETHER_SERVER
-        Renderer2D::BeginScene(viewProjection);
+        if (RenderThread* renderThread = Engine::Get().GetRenderThread())
+            ExtractRenderPacket(viewProjection, renderThread->GetWritePacket().Commands);
+#endif
+    }
+
+    void Scene::ExtractRenderPacket(const glm::mat4& viewProjection, RenderCommandBuffer& commands) {
+        commands.BeginScene(viewProjection);
 
         auto& registry = GetRegistry();
-        auto& sprites = registry.View<SpriteComponent>();
-        auto& owners = registry.GetOwnerMap<SpriteComponent>();
-
-        for (size_t i = 0; i < sprites.size(); i++) {
-            EntityID id = owners.at(i);
-
-            // Refactored for Pointer Safety:
-            // We fetch the transform pointer. if the entity has a sprite but no transform, 
-            // the pointer will be null, and we safely skip drawing.
-            auto* transform = registry.GetComponent<TransformComponent>(id);
-            if (!transform) continue;
-
-            auto& sprite = sprites[i];
-
-            // Use -> access because transform is now a pointer
-            Renderer2D::DrawQuad(
-                { transform->X, transform->Y },
-                { transform->ScaleX, transform->ScaleY },
-                { sprite.R, sprite.G, sprite.B, sprite.A }
-            );
+
+        // Entities without a transform never match, so they are safely skipped.
+        // Read the dense arrays directly (one sparse lookup per pool) and submit to
+        // the render queue, which orders and batches them below.
+        auto* sprites = registry.GetPool<SpriteComponent>();
+        auto* transforms = registry.GetPool<TransformComponent>();
+        const TransformStreams& streams = transforms->Data;
+        const std::vector<EntityID>& entities = m_RenderQuery->GetEntities();
+
+        m_RenderQueue.Clear();
+        m_SpriteStaging.clear();
+        m_SpritePages.clear();
+
+        // --- View Culling ---
+        // With a spatial index only its candidates are visited; otherwise one SIMD pass
+        // over the transform streams marks every on-screen slot, and the render query
+        // is filtered by that mask.
+        const ViewRect view = ComputeViewRect(viewProjection);
+        const std::vector<EntityID>* candidates = &entities;
+
+        if (m_SpatialIndex) {
+            m_CullCandidates.clear();
+            m_SpatialIndex->Query(view, m_CullCandidates);
+            candidates = &m_CullCandidates;
+        }
+        else {
+            m_VisibleSlots.resize(streams.size());
+            CullSprites(streams.X.data(), streams.Y.data(), streams.ScaleX.data(), streams.ScaleY.data(),
+                streams.size(), view, m_VisibleSlots.data());
         }
 
-        Renderer2D::EndScene();
-#endif
+        uint32_t submitted = 0;
+        for (EntityID entity : *candidates) {
+            uint32_t t;
+            if (m_SpatialIndex) {
+                if (!m_RenderQuery->Contains(entity)) continue;
+                t = transforms->IndexOf(entity);
+                if (!IsSpriteVisible(streams.X[t], streams.Y[t], streams.ScaleX[t], streams.ScaleY[t], view)) continue;
+            }
+            else {
+                t = transforms->IndexOf(entity);
+                if (!m_VisibleSlots[t]) continue;
+            }
+            submitted++;
+
+            const SpriteComponent& sprite = sprites->Data[sprites->IndexOf(entity)];
+
+            // Unknown textures fall back to an untextured (tinted) quad
+            const AtlasRegion* region = sprite.Texture ? TextureAtlas::Lookup(sprite.Texture) : nullptr;
+            uint32_t page = region ? region->PageIndex + 1 : 0;
+
+            // Depth is Y (top-down convention: higher on screen is further back). Sprites
+            // are drawn at z = 0 with no depth test, so submission order is what layers
+            // them: every sprite takes the back-to-front path, whether its alpha comes
+            // from the tint or from transparent texels in the atlas.
+            uint32_t payload = (uint32_t)m_SpriteStaging.size();
+            m_RenderQueue.Submit(SortKey::Make(sprite.Layer, true, 0, page, streams.Y[t]), payload);
+            m_SpritePages.push_back(page);
+            m_SpriteStaging.push_back({
+                { streams.X[t], streams.Y[t] },
+                { streams.ScaleX[t], streams.ScaleY[t] },
+                streams.Rotation[t],
+                { sprite.R, sprite.G, sprite.B, sprite.A },
+                region ? region->UV : glm::vec4(0.0f, 0.0f, 1.0f, 1.0f)
+            });
+        }
+
+        m_CullStats.Considered = (uint32_t)entities.size();
+        m_CullStats.Submitted = submitted;
+        m_CullStats.Culled = m_CullStats.Considered - submitted;
+        m_CullStats.UsedSpatialIndex = m_SpatialIndex != nullptr;
+
+        // --- Sort and Batch ---
+        // One radix sort per frame; every run of equal state (layer, texture) between
+        // depth neighbours becomes one instanced draw.
+        m_RenderQueue.Sort();
+
+        m_SpriteRun.clear();
+        uint64_t runState = 0;
+        uint32_t runPage = 0;
+        auto flushRun = [&]() {
+            if (m_SpriteRun.empty()) return;
+            Texture2D* texture = runPage ? TextureAtlas::GetGlobalPage(runPage - 1) : nullptr;
+            commands.DrawInstances(texture, m_SpriteRun.data(), (uint32_t)m_SpriteRun.size());
+            m_SpriteRun.clear();
+        };
+
+        for (const RenderQueue::Entry& entry : m_RenderQueue) {
+            uint64_t state = SortKey::GetStateBits(entry.Key);
+            if (m_SpriteRun.empty() || state != runState) {
+                flushRun();
+                runState = state;
+                runPage = m_SpritePages[entry.Payload];
+            }
+            m_SpriteRun.push_back(m_SpriteStaging[entry.Payload]);
+        }
+        flushRun();
+
+        commands.EndScene();
     }
 }
\ No newline at end of file
@@ -1,13 +1,20 @@
 #pragma once
 
 #include "../ecs/Registry.h"
+#include "../ecs/SystemScheduler.h"
+#include "SimulationLOD.h"
+#include "ViewCulling.h"
+#include "../renderer/SpriteInstance.h"
+#include "../renderer/RenderQueue.h"
 #include "../core/AetherTime.h"
 #include <string>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace aether {
 
     class Entity;
+    class RenderCommandBuffer;
 
     class Scene {
     public:
@@ -18,15 +25,64 @@ namespace aether {
         // Refactored: Scene now accepts the camera matrix from the caller (Client/Editor)
         void OnUpdate(TimeStep ts, const glm::mat4& viewProjection);
 
+        // Records this frame's draws (visible sprites, bucketed by atlas page) into commands.
+        // Does not write the registry, but rebuilds the scene's own extraction scratch
+        // (visibility mask, render queue, staging) and m_CullStats, so it must not run
+        // concurrently with itself. No GL calls, so it runs against any RenderBackend.
+        void ExtractRenderPacket(const glm::mat4& viewProjection, RenderCommandBuffer& commands);
+
         // --- Entity Management ---
         Entity CreateEntity(const std::string& name = std::string());
         void DestroyEntity(Entity entity);
 
+        // First camera with Primary set (index lookup, no pool scan), or a null Entity
+        Entity GetPrimaryCameraEntity();
+
+        // --- Hierarchy ---
+        // Subtree operations gather the subtree once (DFS, root first) and apply the
+        // pool work as a batch. Only the root's links to the outside are patched.
+        void DestroySubtree(Entity root);
+        Entity CloneSubtree(Entity root);
+
+        // Moves child (and its subtree) under newParent; pass a null Entity to make it a root.
+        // Returns false if newParent is inside child's subtree.
+        bool Reparent(Entity child, Entity newParent);
+
+        // Appends root and all of its descendants to out, in depth-first order
+        void GatherSubtree(EntityID root, std::vector<EntityID>& out);
+
         Registry& GetRegistry() { return m_Registry; }
         const Registry& GetRegistry() const { return m_Registry; }
 
+        SystemScheduler& GetScheduler() { return m_Scheduler; }
+        SimulationLOD& GetSimulationLOD() { return m_SimulationLOD; }
+
+        // --- Culling ---
+        // Broad phase for render extraction; not owned. Null = SIMD brute force.
+        void SetSpatialIndex(ISpatialIndex* index) { m_SpatialIndex = index; }
+        // Result of the last ExtractRenderPacket
+        const CullStats& GetCullStats() const { return m_CullStats; }
+
     private:
         Registry m_Registry;
+        SystemScheduler m_Scheduler;
+        SimulationLOD m_SimulationLOD;
+        uint64_t m_TickIndex = 0;
+
+        // Sprite + Transform, minus DisabledTag (owned by m_Registry)
+        CachedQuery* m_RenderQuery = nullptr;
+
+        // Per-frame extraction scratch, reused so steady-state frames do not allocate.
+        // Queue payloads index m_SpriteStaging / m_SpritePages (0 = untextured, else atlas page + 1).
+        RenderQueue m_RenderQueue;
+        std::vector<SpriteInstance> m_SpriteStaging;
+        std::vector<uint32_t> m_SpritePages;
+        std::vector<SpriteInstance> m_SpriteRun;
+
+        ISpatialIndex* m_SpatialIndex = nullptr;
+        std::vector<uint8_t> m_VisibleSlots;       // Per transform dense slot
+        std::vector<EntityID> m_CullCandidates;
+        CullStats m_CullStats;
 
         friend class Entity;
     };
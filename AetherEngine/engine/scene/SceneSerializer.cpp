@@ -1,6 +1,7 @@
 #include "SceneSerializer.h"
 #include "../ecs/Entity.h"
 #include "../ecs/Components.h"
+#include "../ecs/ComponentReflection.h"
 #include "../core/VFS.h"
 #include "../core/Log.h"
 #include "../asset/AssetMetadata.h" // Required for AssetHeader
@@ -19,67 +20,91 @@ namespace aether {
     {
     }
 
+    // --- Reflection Helpers ---
+    // Components with a ComponentReflection table are written as one JSON object
+    // keyed by the table name, with one entry per FieldFlags_Serialize field.
+
+    template<ReflectedComponent T>
+    static json SerializeReflected(const T& component)
+    {
+        json out = json::object();
+        ForEachField<T>(FieldFlags_Serialize, [&](const FieldDescriptor& field)
+            {
+                std::string key(field.Name);
+                switch (field.Type)
+                {
+                case FieldType::Float:  out[key] = GetField<float>(&component, field); break;
+                case FieldType::Bool:   out[key] = GetField<bool>(&component, field); break;
+                case FieldType::Int32:  out[key] = GetField<int32_t>(&component, field); break;
+                case FieldType::UInt32: out[key] = GetField<uint32_t>(&component, field); break;
+                case FieldType::UInt64: out[key] = GetField<uint64_t>(&component, field); break;
+                case FieldType::Enum:   out[key] = GetField<int32_t>(&component, field); break;
+                }
+            });
+        return out;
+    }
+
+    // Missing keys keep the component's default value
+    template<ReflectedComponent T>
+    static void DeserializeReflected(const json& in, T& component)
+    {
+        ForEachField<T>(FieldFlags_Serialize, [&](const FieldDescriptor& field)
+            {
+                auto it = in.find(std::string(field.Name));
+                if (it == in.end() || it->is_null()) return;
+
+                switch (field.Type)
+                {
+                case FieldType::Float:  GetField<float>(&component, field) = it->get<float>(); break;
+                case FieldType::Bool:   GetField<bool>(&component, field) = it->get<bool>(); break;
+                case FieldType::Int32:  GetField<int32_t>(&component, field) = it->get<int32_t>(); break;
+                case FieldType::UInt32: GetField<uint32_t>(&component, field) = it->get<uint32_t>(); break;
+                case FieldType::UInt64: GetField<uint64_t>(&component, field) = it->get<uint64_t>(); break;
+                case FieldType::Enum:
+                {
+                    // Out-of-range values keep the default rather than become an invalid enum
+                    int32_t value = it->get<int32_t>();
+                    if (value >= 0 && (uint32_t)value < field.EnumCount)
+                        GetField<int32_t>(&component, field) = value;
+                    break;
+                }
+                }
+            });
+    }
+
+    template<ReflectedComponent T>
+    static void SerializeComponent(json& outJson, Entity entity)
+    {
+        if (entity.HasComponent<T>())
+            outJson[std::string(ComponentReflection<T>::Name)] = SerializeReflected<T>(entity.GetComponent<T>());
+    }
+
+    template<ReflectedComponent T>
+    static void DeserializeComponent(const json& entityJson, Entity entity)
+    {
+        auto it = entityJson.find(std::string(ComponentReflection<T>::Name));
+        if (it == entityJson.end() || !it->is_object()) return;
+
+        // Start from the existing value: Scene::CreateEntity already adds some components (e.g. Transform).
+        // Works on a plain copy so components with custom storage (SoA transforms) are handled the same way.
+        T component = entity.HasComponent<T>() ? static_cast<T>(entity.GetComponent<T>()) : T{};
+        DeserializeReflected(*it, component);
+        entity.AddComponent<T>(component);
+    }
+
     // Helper to serialize an individual entity safely
     static void SerializeEntity(json& outJson, Entity entity)
     {
-        // 1. Tag Component (Required)
+        // Tag Component (Required, not reflected: variable-length string)
         if (entity.HasComponent<TagComponent>())
         {
             outJson["Tag"] = entity.GetComponent<TagComponent>().Tag;
         }
 
-        // 2. Transform Component
-        if (entity.HasComponent<TransformComponent>())
-        {
-            auto& tc = entity.GetComponent<TransformComponent>();
-            outJson["Transform"] = {
-                { "X", tc.X },
-                { "Y", tc.Y },
-                { "Rotation", tc.Rotation },
-                { "ScaleX", tc.ScaleX },
-                { "ScaleY", tc.ScaleY }
-            };
-        }
-
-        // 3. Sprite Component
-        if (entity.HasComponent<SpriteComponent>())
-        {
-            auto& sc = entity.GetComponent<SpriteComponent>();
-            outJson["Sprite"] = {
-                { "R", sc.R },
-                { "G", sc.G },
-                { "B", sc.B },
-                { "A", sc.A }
-            };
-        }
-
-        // 4. Camera Component
-        if (entity.HasComponent<CameraComponent>()) {
-            auto& cc = entity.GetComponent<CameraComponent>();
-            outJson["CameraComponent"] = {
-                { "ProjectionType", (int)cc.ProjectionType },
-                { "PerspectiveFOV", cc.PerspectiveFOV },
-                { "PerspectiveNear", cc.PerspectiveNear },
-                { "PerspectiveFar", cc.PerspectiveFar },
-                { "OrthographicSize", cc.OrthographicSize },
-                { "OrthographicNear", cc.OrthographicNear },
-                { "OrthographicFar", cc.OrthographicFar },
-                { "Primary", cc.Primary },
-                { "FixedAspectRatio", cc.FixedAspectRatio }
-            };
-        }
-
-        // 5. Relationship Component
-        if (entity.HasComponent<RelationshipComponent>()) {
-            auto& rc = entity.GetComponent<RelationshipComponent>();
-            outJson["Relationship"] = {
-                { "Parent", rc.Parent },
-                { "FirstChild", rc.FirstChild },
-                { "NextSibling", rc.NextSibling },
-                { "PrevSibling", rc.PreviousSibling },
-                { "ChildrenCount", rc.ChildrenCount }
-            };
-        }
+        SerializeComponent<TransformComponent>(outJson, entity);
+        SerializeComponent<SpriteComponent>(outJson, entity);
+        SerializeComponent<CameraComponent>(outJson, entity);
+        SerializeComponent<RelationshipComponent>(outJson, entity);
     }
 
     void SceneSerializer::Serialize(const std::string& filepath)
@@ -179,62 +204,10 @@ namespace aether {
                 std::string name = entityJson["Tag"];
                 Entity deserializedEntity = m_Scene->CreateEntity(name);
 
-                // Transform
-                if (entityJson.contains("Transform"))
-                {
-                    auto& tJson = entityJson["Transform"];
-                    if (tJson.is_object()) {
-                        auto& tc = deserializedEntity.GetComponent<TransformComponent>();
-                        tc.X = tJson.value("X", 0.0f);
-                        tc.Y = tJson.value("Y", 0.0f);
-                        tc.Rotation = tJson.value("Rotation", 0.0f);
-                        tc.ScaleX = tJson.value("ScaleX", 100.0f);
-                        tc.ScaleY = tJson.value("ScaleY", 100.0f);
-                    }
-                }
-
-                // Sprite
-                if (entityJson.contains("Sprite"))
-                {
-                    auto& sJson = entityJson["Sprite"];
-                    if (sJson.is_object()) {
-                        auto& sc = deserializedEntity.AddComponent<SpriteComponent>();
-                        sc.R = sJson.value("R", 1.0f);
-                        sc.G = sJson.value("G", 1.0f);
-                        sc.B = sJson.value("B", 1.0f);
-                        sc.A = sJson.value("A", 1.0f);
-                    }
-                }
-
-                // Camera
-                if (entityJson.contains("CameraComponent")) {
-                    auto& cJson = entityJson["CameraComponent"];
-                    if (cJson.is_object()) {
-                        auto& cc = deserializedEntity.AddComponent<CameraComponent>();
-                        cc.ProjectionType = (CameraComponent::Type)cJson.value("ProjectionType", (int)CameraComponent::Type::Orthographic);
-                        cc.PerspectiveFOV = cJson.value("PerspectiveFOV", glm::radians(45.0f));
-                        cc.PerspectiveNear = cJson.value("PerspectiveNear", 0.01f);
-                        cc.PerspectiveFar = cJson.value("PerspectiveFar", 1000.0f);
-                        cc.OrthographicSize = cJson.value("OrthographicSize", 10.0f);
-                        cc.OrthographicNear = cJson.value("OrthographicNear", -1.0f);
-                        cc.OrthographicFar = cJson.value("OrthographicFar", 1.0f);
-                        cc.Primary = cJson.value("Primary", true);
-                        cc.FixedAspectRatio = cJson.value("FixedAspectRatio", false);
-                    }
-                }
-
-                // Hierarchy
-                if (entityJson.contains("Relationship")) {
-                    auto& rJson = entityJson["Relationship"];
-                    if (rJson.is_object()) {
-                        auto& rc = deserializedEntity.AddComponent<RelationshipComponent>();
-                        rc.Parent = rJson.value("Parent", (EntityID)NULL_ENTITY);
-                        rc.FirstChild = rJson.value("FirstChild", (EntityID)NULL_ENTITY);
-                        rc.NextSibling = rJson.value("NextSibling", (EntityID)NULL_ENTITY);
-                        rc.PreviousSibling = rJson.value("PrevSibling", (EntityID)NULL_ENTITY);
-                        rc.ChildrenCount = rJson.value("ChildrenCount", (size_t)0);
-                    }
-                }
+                DeserializeComponent<TransformComponent>(entityJson, deserializedEntity);
+                DeserializeComponent<SpriteComponent>(entityJson, deserializedEntity);
+                DeserializeComponent<CameraComponent>(entityJson, deserializedEntity);
+                DeserializeComponent<RelationshipComponent>(entityJson, deserializedEntity);
             }
         }
         AETHER_CORE_INFO("Deserialized Scene (Verified) from '{0}'", filepath);
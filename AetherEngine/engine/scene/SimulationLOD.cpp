@@ -0,0 +1,106 @@
+#include "SimulationLOD.h"
+#include "../core/Log.h"
+#include <limits>
+
+namespace aether {
+
+    // Re-tiers every LOD entity, dormant ones included (that is how they wake),
+    // a budgeted window at a time so the cost stays flat with entity count.
+    class SimulationLOD::Evaluator : public TimeSlicedSystem {
+    public:
+        Evaluator(SimulationLOD& owner)
+            : TimeSlicedSystem("SimulationLOD", owner.m_Settings.EvaluateBudgetMs), m_Owner(owner) {
+        }
+
+        const std::vector<EntityID>& GetEntities(Registry& registry) override {
+            return registry.GetOwnerMap<SimulationLODComponent>();
+        }
+
+        void Process(Registry& registry, EntityID entity, TimeStep) override {
+            m_Owner.Evaluate(registry, entity);
+        }
+
+        bool IncludesDormant() const override { return true; }
+
+    private:
+        SimulationLOD& m_Owner;
+    };
+
+    SimulationLOD::SimulationLOD() = default;
+
+    void SimulationLOD::Init(Registry& registry, SystemScheduler& scheduler) {
+        m_Registry = &registry;
+        m_Active = registry.RegisterQuery<SimulationLODComponent, TransformComponent>(Exclude<DormantTag, DisabledTag>{});
+        m_Dormant = registry.RegisterQuery<SimulationLODComponent, DormantTag>();
+        scheduler.AddTimeSliced<Evaluator>(*this);
+    }
+
+    SimulationTier SimulationLOD::ComputeTier(const glm::vec2& position) const {
+        float nearest = std::numeric_limits<float>::max();
+        auto consider = [&](const glm::vec2& observer) {
+            glm::vec2 d = position - observer;
+            nearest = std::min(nearest, d.x * d.x + d.y * d.y);
+        };
+
+        if (m_HasCamera) consider(m_CameraObserver);
+        for (const glm::vec2& client : m_ClientObservers) consider(client);
+
+        // Nobody to observe: keep everything at full rate rather than freezing the world
+        if (nearest == std::numeric_limits<float>::max())
+            return SimulationTier::Full;
+
+        for (int i = 0; i < 3; i++) {
+            float limit = m_Settings.TierDistances[i];
+            if (nearest <= limit * limit)
+                return (SimulationTier)i;
+        }
+        return SimulationTier::Dormant;
+    }
+
+    void SimulationLOD::Evaluate(Registry& registry, EntityID entity) {
+        auto* lod = registry.GetComponent<SimulationLODComponent>(entity);
+        auto transform = registry.GetComponent<TransformComponent>(entity);
+        if (!lod || !transform) return;
+
+        // Recently woken: distance takes over again once the grace period ends
+        if (m_Tick < lod->AwakeUntilTick) return;
+
+        SimulationTier tier = ComputeTier({ transform->X, transform->Y });
+        if (tier == lod->Tier) return;
+
+        // Only the transition touches the tag pool (and with it the cached queries)
+        if (tier == SimulationTier::Dormant)
+            registry.AddComponent<DormantTag>(entity, {});
+        else if (lod->Tier == SimulationTier::Dormant)
+            registry.RemoveComponent<DormantTag>(entity);
+
+        lod->Tier = tier;
+    }
+
+    void SimulationLOD::Wake(Registry& registry, EntityID entity) {
+        auto* lod = registry.GetComponent<SimulationLODComponent>(entity);
+        if (!lod) return;
+
+        if (lod->Tier == SimulationTier::Dormant)
+            registry.RemoveComponent<DormantTag>(entity);
+
+        lod->Tier = SimulationTier::Full;
+        lod->AwakeUntilTick = m_Tick + m_Settings.WakeGraceTicks;
+    }
+
+    void SimulationLOD::BeginTick(uint64_t tick) {
+        m_Tick = tick;
+        m_Due.clear();
+        if (!m_Active) return;
+
+        auto* lods = m_Registry->GetPool<SimulationLODComponent>();
+        for (EntityID entity : m_Active->GetEntities()) {
+            SimulationLODComponent& lod = *lods->Get(entity);
+            uint32_t interval = GetTickInterval(lod.Tier);
+            if (interval != 0 && (tick + lod.Phase) % interval == 0) {
+                lod.DueTick = tick;
+                m_Due.push_back(entity);
+            }
+        }
+    }
+}
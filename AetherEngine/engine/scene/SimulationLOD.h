@@ -0,0 +1,79 @@
+#pragma once
+#include "../ecs/Registry.h"
+#include "../ecs/SystemScheduler.h"
+#include "../ecs/Components.h"
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace aether {
+
+    // --- Simulation LOD ---
+    // Assigns each SimulationLODComponent entity an update tier from its distance
+    // to the nearest observer (camera and/or connected clients). Dormant entities
+    // get DormantTag and drop out of the due list entirely until an observer comes
+    // back in range. Entities without the component are not affected.
+    class SimulationLOD {
+    public:
+        struct Settings {
+            // Upper distance bound (world units) of Full, Half and Quarter; beyond is Dormant
+            float TierDistances[3] = { 1000.0f, 2500.0f, 5000.0f };
+            float EvaluateBudgetMs = 0.5f;
+            // Ticks a woken entity stays at Full before distance applies again
+            uint32_t WakeGraceTicks = 120;
+        };
+
+        SimulationLOD();
+
+        // Registers the queries and the time-sliced tier evaluator
+        void Init(Registry& registry, SystemScheduler& scheduler);
+
+        // Observers: the local camera (client/editor) and connected clients (server).
+        // With no observers at all nothing is simulated at reduced rate.
+        void SetCameraObserver(const glm::vec2& position) { m_CameraObserver = position; m_HasCamera = true; }
+        void ClearCameraObserver() { m_HasCamera = false; }
+        void SetClientObservers(const std::vector<glm::vec2>& positions) { m_ClientObservers = positions; }
+
+        // Builds the due list for this tick and stamps each due entity's DueTick, which
+        // SystemScheduler checks for its ticked systems. Call once per tick before them.
+        void BeginTick(uint64_t tick);
+
+        // Entities that should run logic this tick (not dormant, tier interval reached)
+        const std::vector<EntityID>& GetDueEntities() const { return m_Due; }
+
+        // Forces the entity to Full (clearing DormantTag) for WakeGraceTicks, e.g. when it
+        // is hit or triggered, however far it is from every observer
+        void Wake(Registry& registry, EntityID entity);
+
+        SimulationTier ComputeTier(const glm::vec2& position) const;
+
+        Settings& GetSettings() { return m_Settings; }
+        size_t GetDormantCount() const { return m_Dormant ? m_Dormant->Size() : 0; }
+
+        static uint32_t GetTickInterval(SimulationTier tier) {
+            switch (tier) {
+            case SimulationTier::Full:    return 1;
+            case SimulationTier::Half:    return 2;
+            case SimulationTier::Quarter: return 4;
+            default:                      return 0;
+            }
+        }
+
+    private:
+        void Evaluate(Registry& registry, EntityID entity);
+
+        class Evaluator;
+
+        Settings m_Settings;
+
+        glm::vec2 m_CameraObserver{ 0.0f };
+        bool m_HasCamera = false;
+        std::vector<glm::vec2> m_ClientObservers;
+
+        Registry* m_Registry = nullptr;
+        CachedQuery* m_Active = nullptr;   // LOD + Transform, minus DormantTag/DisabledTag
+        CachedQuery* m_Dormant = nullptr;  // LOD + DormantTag
+        std::vector<EntityID> m_Due;
+        uint64_t m_Tick = 0;
+    };
+}
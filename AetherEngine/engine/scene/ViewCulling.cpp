@@ -0,0 +1,117 @@
+#include "ViewCulling.h"
+#include "../core/SIMD.h"
+#include <algorithm>
+#include <cmath>
+
+namespace aether {
+
+    // Half-extent of the square that encloses a w x h quad at any rotation:
+    // the circumradius 0.5 * sqrt(w^2 + h^2) is at most sqrt(0.5) * max(|w|, |h|)
+    static constexpr float BoundsFactor = 0.70710678f;
+
+    ViewRect ComputeViewRect(const glm::mat4& viewProjection) {
+        const glm::mat4 inverse = glm::inverse(viewProjection);
+        const glm::vec2 corners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { 1.0f, 1.0f }, { -1.0f, 1.0f } };
+
+        // Frustum corners in world space: [0..3] on the near plane, [4..7] on the far plane
+        glm::vec3 frustum[8];
+        for (int i = 0; i < 4; i++) {
+            for (int plane = 0; plane < 2; plane++) {
+                glm::vec4 world = inverse * glm::vec4(corners[i], plane ? 1.0f : -1.0f, 1.0f);
+                frustum[plane * 4 + i] = glm::vec3(world) / world.w;
+            }
+        }
+
+        // The visible part of z = 0 is a polygon whose vertices lie on frustum edges:
+        // the four near-to-far rays plus the outlines of the near and far rectangles
+        ViewRect rect{ INFINITY, INFINITY, -INFINITY, -INFINITY };
+        auto intersect = [&rect](const glm::vec3& a, const glm::vec3& b) {
+            if ((a.z > 0.0f && b.z > 0.0f) || (a.z < 0.0f && b.z < 0.0f)) return;
+            float dz = b.z - a.z;
+            float t = std::fabs(dz) > 1e-12f ? -a.z / dz : 0.0f; // Edge lying in the plane: its start is a vertex
+            float x = a.x + (b.x - a.x) * t;
+            float y = a.y + (b.y - a.y) * t;
+            rect.MinX = std::min(rect.MinX, x);
+            rect.MinY = std::min(rect.MinY, y);
+            rect.MaxX = std::max(rect.MaxX, x);
+            rect.MaxY = std::max(rect.MaxY, y);
+        };
+
+        for (int i = 0; i < 4; i++) {
+            int next = (i + 1) % 4;
+            intersect(frustum[i], frustum[i + 4]);
+            intersect(frustum[i], frustum[next]);
+            intersect(frustum[i + 4], frustum[next + 4]);
+        }
+        return rect;
+    }
+
+    bool IsSpriteVisible(float x, float y, float scaleX, float scaleY, const ViewRect& rect) {
+        float half = BoundsFactor * std::max(std::fabs(scaleX), std::fabs(scaleY));
+        return rect.Overlaps(x - half, y - half, x + half, y + half);
+    }
+
+    void CullSprites(const float* x, const float* y, const float* scaleX, const float* scaleY,
+        size_t count, const ViewRect& rect, uint8_t* visible) {
+        size_t i = 0;
+
+        // Test |x - centerX| <= extentX + half on both axes (the same overlap test, branch-free)
+        const float centerX = (rect.MinX + rect.MaxX) * 0.5f;
+        const float centerY = (rect.MinY + rect.MaxY) * 0.5f;
+        const float extentX = (rect.MaxX - rect.MinX) * 0.5f;
+        const float extentY = (rect.MaxY - rect.MinY) * 0.5f;
+
+#if defined(AETHER_SIMD_AVX2)
+        {
+            const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+            const __m256 factor = _mm256_set1_ps(BoundsFactor);
+            const __m256 cx = _mm256_set1_ps(centerX), cy = _mm256_set1_ps(centerY);
+            const __m256 ex = _mm256_set1_ps(extentX), ey = _mm256_set1_ps(extentY);
+            for (; i + 8 <= count; i += 8) {
+                __m256 half = _mm256_mul_ps(factor, _mm256_max_ps(
+                    _mm256_and_ps(_mm256_loadu_ps(scaleX + i), absMask),
+                    _mm256_and_ps(_mm256_loadu_ps(scaleY + i), absMask)));
+                __m256 dx = _mm256_and_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), cx), absMask);
+                __m256 dy = _mm256_and_ps(_mm256_sub_ps(_mm256_loadu_ps(y + i), cy), absMask);
+                __m256 inside = _mm256_and_ps(
+                    _mm256_cmp_ps(dx, _mm256_add_ps(ex, half), _CMP_LE_OQ),
+                    _mm256_cmp_ps(dy, _mm256_add_ps(ey, half), _CMP_LE_OQ));
+
+                int mask = _mm256_movemask_ps(inside);
+                for (int lane = 0; lane < 8; lane++)
+                    visible[i + lane] = (uint8_t)((mask >> lane) & 1);
+            }
+        }
+#endif
+
+#if defined(AETHER_SIMD_SSE2)
+        {
+            const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+            const __m128 factor = _mm_set1_ps(BoundsFactor);
+            const __m128 cx = _mm_set1_ps(centerX), cy = _mm_set1_ps(centerY);
+            const __m128 ex = _mm_set1_ps(extentX), ey = _mm_set1_ps(extentY);
+            for (; i + 4 <= count; i += 4) {
+                __m128 half = _mm_mul_ps(factor, _mm_max_ps(
+                    _mm_and_ps(_mm_loadu_ps(scaleX + i), absMask),
+                    _mm_and_ps(_mm_loadu_ps(scaleY + i), absMask)));
+                __m128 dx = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(x + i), cx), absMask);
+                __m128 dy = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(y + i), cy), absMask);
+                __m128 inside = _mm_and_ps(
+                    _mm_cmple_ps(dx, _mm_add_ps(ex, half)),
+                    _mm_cmple_ps(dy, _mm_add_ps(ey, half)));
+
+                int mask = _mm_movemask_ps(inside);
+                for (int lane = 0; lane < 4; lane++)
+                    visible[i + lane] = (uint8_t)((mask >> lane) & 1);
+            }
+        }
+#endif
+
+        // Scalar tail (and full fallback on non-x86 targets)
+        for (; i < count; i++) {
+            float half = BoundsFactor * std::max(std::fabs(scaleX[i]), std::fabs(scaleY[i]));
+            visible[i] = (uint8_t)(std::fabs(x[i] - centerX) <= extentX + half &&
+                                   std::fabs(y[i] - centerY) <= extentY + half);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include "../ecs/Components.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace aether {
+
+    // World-space axis-aligned rectangle
+    struct ViewRect {
+        float MinX = 0.0f;
+        float MinY = 0.0f;
+        float MaxX = 0.0f;
+        float MaxY = 0.0f;
+
+        bool Overlaps(float minX, float minY, float maxX, float maxY) const {
+            return minX <= MaxX && maxX >= MinX && minY <= MaxY && maxY >= MinY;
+        }
+    };
+
+    // --- Spatial Index ---
+    // Optional broad phase for culling. When a scene has one, only its candidates are
+    // tested; otherwise every transform is tested by the SIMD brute-force kernel.
+    class ISpatialIndex {
+    public:
+        virtual ~ISpatialIndex() = default;
+
+        // Appends entities whose bounds may overlap rect, each at most once
+        // (false positives are allowed; they are rejected by the exact test)
+        virtual void Query(const ViewRect& rect, std::vector<EntityID>& out) const = 0;
+    };
+
+    // Bounds of the screen on the sprite plane (world z = 0): the view frustum is
+    // unprojected through the inverse view-projection and its edges intersected with
+    // the plane, so orthographic, perspective and rotated cameras are all covered.
+    // Empty (Min > Max) when the plane lies outside the frustum.
+    ViewRect ComputeViewRect(const glm::mat4& viewProjection);
+
+    // --- Cull Kernel ---
+    // visible[i] = 1 if the sprite at (x[i], y[i]) sized (scaleX[i], scaleY[i]) can touch
+    // rect, else 0. Bounds are rotation-invariant (circumscribed square), so rotated
+    // sprites are never culled wrongly. AVX2 / SSE2 / scalar like the transform kernels.
+    void CullSprites(const float* x, const float* y, const float* scaleX, const float* scaleY,
+        size_t count, const ViewRect& rect, uint8_t* visible);
+
+    // Single-sprite version of the same test (spatial index candidates)
+    bool IsSpriteVisible(float x, float y, float scaleX, float scaleY, const ViewRect& rect);
+
+    struct CullStats {
+        uint32_t Considered = 0;
+        uint32_t Culled = 0;
+        uint32_t Submitted = 0;
+        bool UsedSpatialIndex = false;
+    };
+}
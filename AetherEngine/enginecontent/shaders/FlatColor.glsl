@@ -3,8 +3,13 @@
 
 layout(location = 0) in vec3 a_Position;
 
+// Per-frame camera data, shared by all shaders (UniformBinding::Camera)
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+};
+
 // Uniforms (Global variables sent from C++)
-uniform mat4 u_ViewProjection;
 uniform mat4 u_Transform;
 
 void main()
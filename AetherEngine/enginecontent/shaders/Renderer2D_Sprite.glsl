@@ -0,0 +1,58 @@
+#type vertex
+#version 450 core
+
+// Per-vertex: unit quad centred on the origin
+layout(location = 0) in vec2 a_Position;
+
+// Per-instance (divisor 1): must match SpriteInstance (renderer/SpriteInstance.h)
+layout(location = 1) in vec2 i_Position;
+layout(location = 2) in vec2 i_Scale;
+layout(location = 3) in float i_Rotation;
+layout(location = 4) in vec4 i_Color;
+layout(location = 5) in vec4 i_UV;
+
+// Per-frame camera data, shared by all shaders (UniformBinding::Camera)
+layout(std140, binding = 0) uniform Camera
+{
+    mat4 u_ViewProjection;
+};
+
+out vec4 v_Color;
+out vec2 v_TexCoord;
+
+void main()
+{
+    // Scale, rotate, translate: the per-sprite math runs here instead of on the CPU
+    vec2 scaled = a_Position * i_Scale;
+    float s = sin(i_Rotation);
+    float c = cos(i_Rotation);
+    vec2 world = vec2(c * scaled.x - s * scaled.y, s * scaled.x + c * scaled.y) + i_Position;
+
+    v_Color = i_Color;
+    v_TexCoord = mix(i_UV.xy, i_UV.zw, a_Position + 0.5);
+    gl_Position = u_ViewProjection * vec4(world, 0.0, 1.0);
+}
+
+#type fragment
+#version 450 core
+
+layout(location = 0) out vec4 color;
+
+in vec4 v_Color;
+in vec2 v_TexCoord;
+
+// Atlas page (or the white texture for untextured sprites)
+layout(binding = 0) uniform sampler2D u_Texture;
+
+// Non-zero for premultiplied (cooked) textures; straight alpha is converted here
+uniform int u_Premultiplied;
+
+void main()
+{
+    vec4 texColor = texture(u_Texture, v_TexCoord);
+    if (u_Premultiplied == 0)
+        texColor.rgb *= texColor.a;
+
+    // Premultiplied output: Renderer2D blends with (ONE, ONE_MINUS_SRC_ALPHA)
+    color = texColor * vec4(v_Color.rgb * v_Color.a, v_Color.a);
+}